@@ -31,7 +31,6 @@ tab-size = 4
 #include <iostream>
 #include <exception>
 #include <tuple>
-#include <regex>
 #include <chrono>
 #include <utility>
 #ifdef __APPLE__
@@ -71,6 +70,19 @@ using namespace Tools;
 using namespace std::chrono_literals;
 using namespace std::literals;
 
+#ifdef BTOP_DEBUG
+//? Count heap allocations per thread, shown in the debug box for the collect and draw steps
+thread_local uint64_t Tools::allocations{};
+
+void* operator new(std::size_t size) {
+	++Tools::allocations;
+	if (void* ptr = std::malloc(size == 0 ? 1 : size)) return ptr;
+	throw std::bad_alloc();
+}
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+#endif
+
 namespace Global {
 	const vector<array<string, 2>> Banner_src = {
 		{"#E62525", "██████╗ ████████╗ ██████╗ ██████╗"},
@@ -466,8 +478,10 @@ namespace Runner {
 		}
 	};
 
-	string output;
+	string output;	// Arena for the current update, boxes append to it and it keeps its capacity between updates
 	string empty_bg;
+	Draw::Frame frame;
+	std::pair<size_t, size_t> debug_bytes;	// Bytes drawn and written to the terminal in the last update
 	bool pause_output{};
 	sigset_t mask;
 	pthread_t runner_id;
@@ -488,6 +502,9 @@ namespace Runner {
 
 	string debug_bg;
 	std::unordered_map<string, array<uint64_t, 2>> debug_times;
+#ifdef BTOP_DEBUG
+	std::unordered_map<string, array<uint64_t, 2>> debug_allocs;
+#endif
 
 	class MyNumPunct : public std::numpunct<char>
 	{
@@ -508,30 +525,37 @@ namespace Runner {
 
 	struct runner_conf current_conf;
 
-	void debug_timer(const char* name, const int action) {
+	void debug_measure(std::unordered_map<string, array<uint64_t, 2>>& stats, const uint64_t now, const char* name, const int action) {
 		switch (action) {
 			case collect_begin:
-				debug_times[name].at(collect) = time_micros();
+				stats[name].at(collect) = now;
 				return;
 			case collect_done:
-				debug_times[name].at(collect) = time_micros() - debug_times[name].at(collect);
-				debug_times["total"].at(collect) += debug_times[name].at(collect);
+				stats[name].at(collect) = now - stats[name].at(collect);
+				stats["total"].at(collect) += stats[name].at(collect);
 				return;
 			case draw_begin_only:
-				debug_times[name].at(draw) = time_micros();
+				stats[name].at(draw) = now;
 				return;
 			case draw_begin:
-				debug_times[name].at(draw) = time_micros();
-				debug_times[name].at(collect) = debug_times[name].at(draw) - debug_times[name].at(collect);
-				debug_times["total"].at(collect) += debug_times[name].at(collect);
+				stats[name].at(draw) = now;
+				stats[name].at(collect) = stats[name].at(draw) - stats[name].at(collect);
+				stats["total"].at(collect) += stats[name].at(collect);
 				return;
 			case draw_done:
-				debug_times[name].at(draw) = time_micros() - debug_times[name].at(draw);
-				debug_times["total"].at(draw) += debug_times[name].at(draw);
+				stats[name].at(draw) = now - stats[name].at(draw);
+				stats["total"].at(draw) += stats[name].at(draw);
 				return;
 		}
 	}
 
+	void debug_timer(const char* name, const int action) {
+		debug_measure(debug_times, time_micros(), name, action);
+	#ifdef BTOP_DEBUG
+		debug_measure(debug_allocs, Tools::allocations, name, action);
+	#endif
+	}
+
 	//? ------------------------------- Secondary thread: async launcher and drawing ----------------------------------
 	void * _runner(void *) {
 		//? Block some signals in this thread to avoid deadlock from any signal handlers trying to stop this thread
@@ -579,14 +603,21 @@ namespace Runner {
                 if (debug_bg.empty() or redraw)
                     Runner::debug_bg = Draw::createBox(2, 2, 33,
 					#ifdef GPU_SUPPORT
-						9,
+						11
 					#else
-						8,
+						10
+					#endif
+					#ifdef BTOP_DEBUG
+						+ 1
 					#endif
-					"", true, "μs");
+					, "", true, "μs");
 
 				debug_times.clear();
 				debug_times["total"] = {0, 0};
+			#ifdef BTOP_DEBUG
+				debug_allocs.clear();
+				debug_allocs["total"] = {0, 0};
+			#endif
 			}
 
 			output.clear();
@@ -635,7 +666,7 @@ namespace Runner {
 						if (Global::debug) debug_timer("cpu", draw_begin);
 
 						//? Draw box
-						if (not pause_output) output += Cpu::draw(cpu, gpus_ref, conf.force_redraw, conf.no_update);
+						if (not pause_output) Cpu::draw(output, cpu, gpus_ref, conf.force_redraw, conf.no_update);
 
 						if (Global::debug) debug_timer("cpu", draw_done);
 					}
@@ -652,7 +683,7 @@ namespace Runner {
 						//? Draw box
 						if (not pause_output)
 							for (unsigned long i = 0; i < gpu_panels.size(); ++i)
-								output += Gpu::draw(gpus_ref[gpu_panels[i]], i, conf.force_redraw, conf.no_update);
+								Gpu::draw(output, gpus_ref[gpu_panels[i]], i, conf.force_redraw, conf.no_update);
 
 						if (Global::debug) debug_timer("gpu", draw_done);
 					}
@@ -672,7 +703,7 @@ namespace Runner {
 						if (Global::debug) debug_timer("mem", draw_begin);
 
 						//? Draw box
-						if (not pause_output) output += Mem::draw(mem, conf.force_redraw, conf.no_update);
+						if (not pause_output) Mem::draw(output, mem, conf.force_redraw, conf.no_update);
 
 						if (Global::debug) debug_timer("mem", draw_done);
 					}
@@ -692,7 +723,7 @@ namespace Runner {
 						if (Global::debug) debug_timer("net", draw_begin);
 
 						//? Draw box
-						if (not pause_output) output += Net::draw(net, conf.force_redraw, conf.no_update);
+						if (not pause_output) Net::draw(output, net, conf.force_redraw, conf.no_update);
 
 						if (Global::debug) debug_timer("net", draw_done);
 					}
@@ -712,7 +743,7 @@ namespace Runner {
 						if (Global::debug) debug_timer("proc", draw_begin);
 
 						//? Draw box
-						if (not pause_output) output += Proc::draw(proc, conf.force_redraw, conf.no_update);
+						if (not pause_output) Proc::draw(output, proc, conf.force_redraw, conf.no_update);
 
 						if (Global::debug) debug_timer("proc", draw_done);
 					}
@@ -792,13 +823,65 @@ namespace Runner {
 						"draw"_a = time_draw
 					);
 				}
+			#ifdef BTOP_DEBUG
+				//? Heap allocations made by all collect and draw steps
+				output += fmt::format(loc, "{mvLD}{name:5.5} {collect:12L} {draw:12L}",
+					"mvLD"_a = Mv::l(31) + Mv::d(1),
+					"name"_a = "alloc",
+					"collect"_a = debug_allocs["total"].at(collect),
+					"draw"_a = debug_allocs["total"].at(draw)
+				);
+			#endif
+
+				//? Output size of the last update, before and after only writing changed cells
+				output += fmt::format(loc, "{mvLD}{pre}{box:5.5} {drawn:>12.12} {written:>12.12}{post}{mvLD}{name:5.5} {drawn_bytes:12L} {written_bytes:12L}",
+					"mvLD"_a = Mv::l(31) + Mv::d(1),
+					"pre"_a = Theme::c("title") + Fx::b, "post"_a = Theme::c("main_fg") + Fx::ub,
+					"box"_a = "bytes", "drawn"_a = "drawn", "written"_a = "written",
+					"name"_a = "frame",
+					"drawn_bytes"_a = debug_bytes.first,
+					"written_bytes"_a = debug_bytes.second
+				);
+			}
+
+			//? Keep the screen model current and only write changed cells, unless a menu is drawn on top of it
+			const bool diff_output = Config::getB("diff_output");
+			if (diff_output) {
+				frame.resize(Term::width, Term::height);
+				if (conf.force_redraw) frame.invalidate();
+				frame.write(output);
 			}
+			if (diff_output and conf.overlay.empty()) {
+				//? REP is missing from the linux console and GNU screen
+				static const bool rep_term = [] {
+					const string term = (std::getenv("TERM") != nullptr ? std::getenv("TERM") : "");
+					return not (Term::current_tty.starts_with("/dev/tty") or term.starts_with("linux")
+						or (term.starts_with("screen") and std::getenv("TMUX") == nullptr));
+				}();
+				frame.use_rep = rep_term and not Config::getB("tty_mode");
+				const string diff = frame.diff();
+				debug_bytes = {output.size(), diff.size()};
+				cout << Term::sync_start << diff << Term::sync_end << flush;
+			}
+			else {
+				debug_bytes = {output.size(), output.size()};
+				frame.invalidate();
 
-			//? If overlay isn't empty, print output without color and then print overlay on top
-			cout << Term::sync_start << (conf.overlay.empty()
-					? output
-					: (output.empty() ? "" : Fx::ub + Theme::c("inactive_fg") + Fx::uncolor(output)) + conf.overlay)
-				<< Term::sync_end << flush;
+				//? If overlay isn't empty, print output without color and then print overlay on top
+				if (conf.overlay.empty())
+					cout << Term::sync_start << output << Term::sync_end << flush;
+				else {
+					static string dimmed;
+					dimmed.clear();
+					if (not output.empty()) {
+						dimmed += Fx::ub;
+						dimmed += Theme::c("inactive_fg");
+						Fx::uncolor_to(dimmed, output);
+					}
+					dimmed += conf.overlay;
+					cout << Term::sync_start << dimmed << Term::sync_end << flush;
+				}
+			}
 		}
 		//* ----------------------------------------------- THREAD LOOP -----------------------------------------------
 		return {};
@@ -821,10 +904,12 @@ namespace Runner {
 		if (stopping or Global::resized) return;
 
 		if (box == "overlay") {
+			frame.invalidate();
 			cout << Term::sync_start << Global::overlay << Term::sync_end << flush;
 		}
 		else if (box == "clock") {
-			cout << Term::sync_start << Global::clock << Term::sync_end << flush;
+			if (Config::getB("diff_output")) frame.write(Global::clock);
+			cout << Term::sync_start << (Config::getB("diff_output") and frame.valid() ? frame.diff() : Global::clock) << Term::sync_end << flush;
 		}
 		else {
 			Config::unlock();
@@ -113,6 +113,10 @@ namespace Config {
 
 		{"proc_aggregate",		"#* In tree-view, always accumulate child process resources in the parent process."},
 
+		{"proc_numa",			"#* (Linux) Show the NUMA node of the cpu each process last ran on."},
+
+		{"proc_fds",			"#* (Linux) Show open file descriptor and socket counts, visible processes are counted every update and the rest a few at a time."},
+
 		{"cpu_graph_upper", 	"#* Sets the CPU stat shown in upper half of the CPU graph, \"total\" is always available.\n"
 								"#* Select from a list of detected attributes from the options menu."},
 
@@ -146,11 +150,21 @@ namespace Config {
 
 		{"show_cpu_freq", 		"#* Show CPU frequency."},
 
+		{"show_core_freq", 		"#* Show per core frequency and thermal throttle events instead of per core usage graphs, Linux only."},
+
+		{"cpu_irq_matrix", 		"#* Show interrupt and softirq rates per cpu instead of the cpu graphs, Linux only."},
+
+		{"cpu_core_layout", 	"#* How to show cores in the cpu box, \"graphs\" for a graph per core, \"grid\" for a colored cell per core grouped by\n"
+								"#* NUMA node, socket or L3 cache. \"Auto\" uses \"grid\" above 128 logical cpus."},
+
 		{"clock_format", 		"#* Draw a clock at top of screen, formatting according to strftime, empty string to disable.\n"
 								"#* Special formatting: /host = hostname | /user = username | /uptime = system uptime"},
 
 		{"background_update", 	"#* Update main ui in background when menus are showing, set this to false if the menus is flickering too much for comfort."},
 
+		{"diff_output", 		"#* Only write the parts of the screen that changed since last update, greatly reduces output over slow connections like ssh.\n"
+								"#* Set to false if the screen gets garbled, which can happen with terminals disagreeing on the width of some characters."},
+
 		{"custom_cpu_name", 	"#* Custom cpu model name, empty string to disable."},
 
 		{"disks_filter", 		"#* Optional filter for shown disks, should be full path of a mountpoint, separate multiple values with whitespace \" \".\n"
@@ -158,6 +172,13 @@ namespace Config {
 
 		{"mem_graphs", 			"#* Show graphs instead of meters for memory values."},
 
+		{"mem_extra_stats", 	"#* Extra memory values shown below the memory values as meters or graphs, space separated. Linux only.\n"
+								"#* Available: \"dirty writeback shmem slab_reclaimable slab_unreclaimable anon_hugepages hugepages_total hugepages_free mlocked\""},
+
+		{"mem_panel", 			"#* Panel shown to the right of memory values in the mem box, \"disks\", \"numa\" for per NUMA node memory or\n"
+								"#* \"kernel\" for context switch, fork, page fault, swap and reclaim rates or \"swap\" for swap areas, zram and zswap.\n"
+								"#* \"numa\", \"kernel\" and \"swap\" are Linux only."},
+
 		{"mem_below_net",		"#* Show mem box below net box instead of above."},
 
 		{"zfs_arc_cached",		"#* Count ZFS ARC in cached and available memory."},
@@ -172,12 +193,18 @@ namespace Config {
 
 		{"use_fstab", 			"#* Read disks list from /etc/fstab. This also disables only_physical."},
 
+		{"disks_group",			"#* (Linux) Collapse overlay, tmpfs and squashfs mounts into one summary row per type and hide repeated mounts of the same device."},
+
 		{"zfs_hide_datasets",		"#* Setting this to True will hide all datasets, and only show ZFS pools. (IO stats will be calculated per-pool)"},
 
 		{"disk_free_priv",		"#* Set to true to show available disk space for privileged users."},
 
 		{"show_io_stat", 		"#* Toggles if io activity % (disk busy time) should be shown in regular disk usage view."},
 
+		{"io_graph_stat", 		"#* Value shown in the small per disk io graph, \"activity\" for disk busy time %, \"iops\" for read and write operations\n"
+								"#* per second, \"await\" for average latency per operation, \"queue\" for average queue depth or \"discard\" for discard speed.\n"
+								"#* Values other than \"activity\" are Linux only."},
+
 		{"io_mode", 			"#* Toggles io mode for disks, showing big graphs for disk read/write speeds."},
 
 		{"io_graph_combined", 	"#* Set to True to show combined read/write io graphs in io mode."},
@@ -195,6 +222,18 @@ namespace Config {
 
 		{"net_iface", 			"#* Starts with the Network Interface specified here."},
 
+		{"net_groups", 			"#* (Linux) Show interfaces matching glob patterns as one aggregated interface, space separated \"name=pattern,pattern\" rules.\n"
+								"#* Example: \"veth=veth* pods=cali*,flannel*\"."},
+
+		{"net_packet_stats", 	"#* Show packets per second, average packet size and drop/error rates below the download/upload stats if there is room."},
+
+		{"net_packet_graph", 	"#* Add a graph of received + transmitted packets per second to the packet stats."},
+
+		{"net_proto_stats", 	"#* (Linux) Show TCP opens, retransmits, established connections, listen overflows/drops and UDP receive buffer errors\n"
+								"#* left of the download/upload stats, read from /proc/net/snmp and /proc/net/netstat only when enabled."},
+
+		{"net_top_talkers", 	"#* Number of busiest interfaces by current rate to list below the download/upload stats, 0 to disable."},
+
 		{"show_battery", 		"#* Show battery stats in top right if battery is present."},
 
 		{"selected_battery",	"#* Which battery to use if multiple are present. \"Auto\" for auto detection."},
@@ -236,11 +275,16 @@ namespace Config {
 		{"selected_battery", "Auto"},
 		{"cpu_core_map", ""},
 		{"temp_scale", "celsius"},
+		{"cpu_core_layout", "Auto"},
+		{"mem_panel", "disks"},
+		{"io_graph_stat", "activity"},
+		{"mem_extra_stats", ""},
 		{"clock_format", "%X"},
 		{"custom_cpu_name", ""},
 		{"disks_filter", ""},
 		{"io_graph_speeds", ""},
 		{"net_iface", ""},
+		{"net_groups", ""},
 		{"log_level", "WARNING"},
 		{"proc_filter", ""},
 		{"proc_command", ""},
@@ -278,7 +322,10 @@ namespace Config {
 		{"check_temp", true},
 		{"show_coretemp", true},
 		{"show_cpu_freq", true},
+		{"show_core_freq", false},
+		{"cpu_irq_matrix", false},
 		{"background_update", true},
+		{"diff_output", true},
 		{"mem_graphs", true},
 		{"mem_below_net", false},
 		{"zfs_arc_cached", true},
@@ -287,6 +334,7 @@ namespace Config {
 		{"show_disks", true},
 		{"only_physical", true},
 		{"use_fstab", true},
+		{"disks_group", false},
 		{"zfs_hide_datasets", false},
 		{"show_io_stat", true},
 		{"io_mode", false},
@@ -304,6 +352,11 @@ namespace Config {
 		{"show_detailed", false},
 		{"proc_filtering", false},
 		{"proc_aggregate", false},
+		{"proc_numa", false},
+		{"proc_fds", false},
+		{"net_packet_stats", false},
+		{"net_packet_graph", false},
+		{"net_proto_stats", false},
 	#ifdef GPU_SUPPORT
 		{"nvml_measure_pcie_speeds", true},
 		{"gpu_mirror_graph", true},
@@ -315,6 +368,7 @@ namespace Config {
 		{"update_ms", 2000},
 		{"net_download", 100},
 		{"net_upload", 100},
+		{"net_top_talkers", 0},
 		{"detailed_pid", 0},
 		{"selected_pid", 0},
 		{"selected_depth", 0},
@@ -324,6 +378,10 @@ namespace Config {
 	};
 	std::unordered_map<std::string_view, int> intsTmp;
 
+	Tools::hashed_index<bool> bools_index{bools};
+	Tools::hashed_index<int> ints_index{ints};
+	Tools::hashed_index<string> strings_index{strings};
+
 	// Returns a valid config dir or an empty optional
 	// The config dir might be read only, a warning is printed, but a path is returned anyway
 	[[nodiscard]] std::optional<fs::path> get_config_dir() noexcept {
@@ -494,6 +552,9 @@ namespace Config {
 		else if (name == "update_ms" and i_value > ONE_DAY_MILLIS)
 			validError = fmt::format("Config value update_ms set too high (>{}).", ONE_DAY_MILLIS);
 
+		else if (name == "net_top_talkers" and (i_value < 0 or i_value > 50))
+			validError = "Config value net_top_talkers must be between 0 and 50.";
+
 		else
 			return true;
 
@@ -510,6 +571,28 @@ namespace Config {
 		else if (name.starts_with("graph_symbol_") and (value != "default" and not v_contains(valid_graph_symbols, value)))
 			validError = fmt::format("Invalid graph symbol identifier for {}: {}", name, value);
 
+		else if (name == "cpu_core_layout" and not v_contains(cpu_core_layouts, value))
+			validError = "Invalid value for cpu_core_layout: " + value;
+
+		else if (name == "mem_panel" and not v_contains(mem_panels, value))
+			validError = "Invalid value for mem_panel: " + value;
+
+		else if (name == "io_graph_stat" and not v_contains(io_graph_stats, value))
+			validError = "Invalid value for io_graph_stat: " + value;
+
+		else if (name == "mem_extra_stats" and not value.empty()
+			and not rng::all_of(ssplit(value), [](const string& name) {
+				return rng::any_of(Mem::extra_names, [&](const auto& stat) { return Mem::stat_names[stat] == name; });
+			}))
+			validError = "Invalid value for mem_extra_stats: " + value;
+
+		else if (name == "net_groups" and not value.empty()
+			and not rng::all_of(ssplit(value), [](const string& rule) {
+				const auto eq = rule.find('=');
+				return eq != string::npos and eq > 0 and eq + 1 < rule.size();
+			}))
+			validError = "Invalid value for net_groups, expected \"name=pattern,pattern\" rules: " + value;
+
 		else if (name == "shown_boxes" and not Global::init_conf and not value.empty() and not check_boxes(value))
 			validError = "Invalid box name(s) in shown_boxes!";
 
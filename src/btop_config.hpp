@@ -25,6 +25,8 @@ tab-size = 4
 
 #include <unordered_map>
 
+#include "btop_tools.hpp"
+
 using std::string;
 using std::vector;
 
@@ -41,6 +43,12 @@ namespace Config {
 	extern std::unordered_map<std::string_view, int> ints;
 	extern std::unordered_map<std::string_view, int> intsTmp;
 
+	//? Indexes into the values above for names hashed at compile time. Changes are cached while the config is locked,
+	//? so reads through them see the same values for the whole update, like a snapshot taken at lock()
+	extern Tools::hashed_index<bool> bools_index;
+	extern Tools::hashed_index<int> ints_index;
+	extern Tools::hashed_index<string> strings_index;
+
 	const vector<string> valid_graph_symbols = { "braille", "block", "tty" };
 	const vector<string> valid_graph_symbols_def = { "default", "braille", "block", "tty" };
 	const vector<string> valid_boxes = {
@@ -50,6 +58,9 @@ namespace Config {
 #endif
 		};
 	const vector<string> temp_scales = { "celsius", "fahrenheit", "kelvin", "rankine" };
+	const vector<string> cpu_core_layouts = { "Auto", "graphs", "grid" };
+	const vector<string> mem_panels = { "disks", "numa", "kernel", "swap" };
+	const vector<string> io_graph_stats = { "activity", "iops", "await", "queue", "discard" };
 #ifdef GPU_SUPPORT
 	const vector<string> show_gpu_values = { "Auto", "On", "Off" };
 #endif
@@ -77,13 +88,28 @@ namespace Config {
 	bool _locked(const std::string_view name);
 
 	//* Return bool for config key <name>
-	inline bool getB(const std::string_view name) { return bools.at(name); }
+	inline bool getB(const Tools::hashed_name& name) {
+		if (const bool* value = bools_index.find(name)) return *value;
+		return bools.at(name.name);
+	}
+	template<Tools::runtime_name T>
+	inline bool getB(const T& name) { return bools.at(name); }
 
 	//* Return integer for config key <name>
-	inline const int& getI(const std::string_view name) { return ints.at(name); }
+	inline const int& getI(const Tools::hashed_name& name) {
+		if (const int* value = ints_index.find(name)) return *value;
+		return ints.at(name.name);
+	}
+	template<Tools::runtime_name T>
+	inline const int& getI(const T& name) { return ints.at(name); }
 
 	//* Return string for config key <name>
-	inline const string& getS(const std::string_view name) { return strings.at(name); }
+	inline const string& getS(const Tools::hashed_name& name) {
+		if (const string* value = strings_index.find(name)) return *value;
+		return strings.at(name.name);
+	}
+	template<Tools::runtime_name T>
+	inline const string& getS(const T& name) { return strings.at(name); }
 
 	string getAsString(const std::string_view name);
 
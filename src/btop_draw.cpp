@@ -18,6 +18,8 @@ tab-size = 4
 
 #include <array>
 #include <algorithm>
+#include <bit>
+#include <charconv>
 #include <cmath>
 #include <ranges>
 #include <stdexcept>
@@ -364,11 +366,10 @@ namespace Draw {
 	Meter::Meter(const int width, const string& color_gradient, bool invert)
 		: width(width), color_gradient(color_gradient), invert(invert) {}
 
-	string Meter::operator()(int value) {
-		if (width < 1) return "";
+	const string& Meter::operator()(int value) {
 		value = clamp(value, 0, 100);
-		if (not cache.at(value).empty()) return cache.at(value);
 		auto& out = cache.at(value);
+		if (width < 1 or not out.empty()) return out;
 		for (const int& i : iota(1, width + 1)) {
 			int y = round((double)i * 100.0 / width);
 			if (value >= y)
@@ -383,12 +384,57 @@ namespace Draw {
 	}
 
 	//* Graph class ------------------------------------------------------------------------------------------------------------>
+	void Graph::Ring::grow(size_t need) {
+		//? Linearize into larger buffers, oldest column first
+		string new_buf;
+		new_buf.reserve(max(buf.size() * 2, bytes + need));
+		append_to(new_buf);
+		new_buf.resize(new_buf.capacity());
+		vector<uint8_t> new_lengths(max<size_t>(lengths.size() * 2, columns + 1));
+		for (size_t i = 0; i < columns; i++) new_lengths[i] = lengths[(first + i) % lengths.size()];
+		buf = std::move(new_buf);
+		lengths = std::move(new_lengths);
+		head = first = 0;
+	}
+
+	void Graph::Ring::reserve(size_t columns, size_t column_bytes) {
+		buf.resize(max<size_t>(columns * column_bytes, 1));
+		lengths.resize(max<size_t>(columns + 1, 1));
+	}
+
+	void Graph::Ring::push(std::string_view column) {
+		if (bytes + column.size() > buf.size() or columns == lengths.size()) grow(column.size());
+		const size_t tail = (head + bytes) % buf.size();
+		const size_t split = min(column.size(), buf.size() - tail);
+		std::copy_n(column.data(), split, buf.data() + tail);
+		std::copy_n(column.data() + split, column.size() - split, buf.data());
+		lengths[(first + columns) % lengths.size()] = column.size();
+		bytes += column.size();
+		columns++;
+	}
+
+	void Graph::Ring::pop() {
+		if (columns == 0) return;
+		const size_t length = lengths[first];
+		head = (head + length) % buf.size();
+		bytes -= length;
+		first = (first + 1) % lengths.size();
+		columns--;
+	}
+
+	void Graph::Ring::append_to(string& out) const {
+		const size_t split = min(bytes, buf.size() - head);
+		out.append(buf.data() + head, split);
+		out.append(buf.data(), bytes - split);
+	}
+
 	void Graph::_create(const deque<long long>& data, int data_offset) {
 		bool mult = (data.size() - data_offset > 1);
-		const auto& graph_symbol = Symbols::graph_symbols.at(symbol + '_' + (invert ? "down" : "up"));
+		const auto& graph_symbol = *glyphs;
 		array<int, 2> result;
 		const float mod = (height == 1) ? 0.3 : 0.1;
 		long long data_value = 0;
+		string column;
 		if (mult and data_offset > 0) {
 			last = data.at(data_offset - 1);
 			if (max_value > 0) last = clamp((last + offset) * 100 / max_value, 0ll, 100ll);
@@ -396,7 +442,6 @@ namespace Draw {
 
 		//? Horizontal iteration over values in <data>
 		for (const int& i : iota(data_offset, (int)data.size())) {
-			// if (tty_mode and mult and i % 2 != 0) continue;
 			if (not tty_mode and mult) current = not current;
 			if (i < 0) {
 				data_value = 0;
@@ -422,34 +467,36 @@ namespace Draw {
 						result[ai++] = clamp((int)round((float)(value - cur_low) * 4 / (cur_high - cur_low) + mod), clamp_min, 4);
 					}
 				}
-				//? Generate graph symbol from 5x5 2D vector
+				//? Add graph symbol from 5x5 table as a new column, colored per column when height is 1
+				auto& row = rows[current][horizon];
 				if (height == 1) {
-					if (result.at(0) + result.at(1) == 0) graphs.at(current).at(horizon) += Mv::r(1);
+					if (result[0] + result[1] == 0) row.push("\x1b[1C");
 					else {
-						if (not color_gradient.empty()) graphs.at(current).at(horizon) += Theme::g(color_gradient).at(clamp(max(last, data_value), 0ll, 100ll));
-						graphs.at(current).at(horizon) += graph_symbol.at((result.at(0) * 5 + result.at(1)));
+						column.clear();
+						if (gradient != nullptr) column += (*gradient)[clamp(max(last, data_value), 0ll, 100ll)];
+						column += graph_symbol[result[0] * 5 + result[1]];
+						row.push(column);
 					}
 				}
-				else graphs.at(current).at(horizon) += graph_symbol.at((result.at(0) * 5 + result.at(1)));
+				else row.push(graph_symbol[result[0] * 5 + result[1]]);
 			}
 			if (mult and i >= 0) last = data_value;
 		}
 		last = data_value;
+
+		//? Assemble output from the rings of the current graph
 		out.clear();
-		if (height == 1) {
-			//if (not color_gradient.empty())
-			//	out += (last < 1 ? Theme::c("inactive_fg") : Theme::g(color_gradient).at(clamp(last, 0ll, 100ll)));
-			out += graphs.at(current).at(0);
-		}
+		if (height == 1)
+			rows[current][0].append_to(out);
 		else {
 			for (const int& i : iota(1, height + 1)) {
-				if (i > 1) out += Mv::d(1) + Mv::l(width);
-				if (not color_gradient.empty())
-					out += (invert) ? Theme::g(color_gradient).at(i * 100 / height) : Theme::g(color_gradient).at(100 - ((i - 1) * 100 / height));
-				out += (invert) ? graphs.at(current).at(height - i) : graphs.at(current).at(i-1);
+				if (i > 1) out += next_row;
+				if (gradient != nullptr)
+					out += (invert) ? (*gradient)[i * 100 / height] : (*gradient)[100 - ((i - 1) * 100 / height)];
+				rows[current][(invert) ? height - i : i - 1].append_to(out);
 			}
 		}
-		if (not color_gradient.empty()) out += Fx::reset;
+		if (gradient != nullptr) out += Fx::reset;
 	}
 
 	Graph::Graph() {}
@@ -464,6 +511,15 @@ namespace Draw {
 		else this->symbol = Config::getS("graph_symbol");
 		if (this->symbol == "tty") tty_mode = true;
 
+		//? Symbol table and gradient are resolved once instead of for every new value
+		glyphs = &Symbols::graph_symbols.at(this->symbol + '_' + (invert ? "down" : "up"));
+		if (not color_gradient.empty()) gradient = &Theme::g(color_gradient);
+		theme_generation = Theme::generation;
+		next_row = Mv::d(1) + Mv::l(width);
+		size_t column_bytes = 4;
+		if (height == 1 and gradient != nullptr)
+			column_bytes += rng::max(*gradient, {}, &string::size).size();
+
 		if (max_value == 0 and offset > 0) max_value = 100;
 		this->max_value = max_value;
 		const int value_width = (tty_mode ? data.size() : ceil((double)data.size() / 2));
@@ -473,10 +529,14 @@ namespace Draw {
 			data_offset--;
 		}
 
-		//? Populate the two switching graph vectors and fill empty space if data size < width
-		for (const int& i : iota(0, height * 2)) {
-			if (tty_mode and i % 2 != current) continue;
-			graphs[(i % 2 != 0)].push_back((value_width < width) ? ((height == 1) ? Mv::r(1) : " "s) * (width - value_width) : "");
+		//? Populate the two switching graphs and fill empty space if data size < width
+		for (const int& i : iota(0, 2)) {
+			if (tty_mode and i != current) continue;
+			rows[i].resize(height);
+			for (auto& row : rows[i]) {
+				row.reserve(width + 1, column_bytes);
+				for (int pad = value_width; pad < width; pad++) row.push((height == 1) ? "\x1b[1C" : " ");
+			}
 		}
 		if (data.size() == 0) return;
 		this->_create(data, data_offset);
@@ -485,16 +545,15 @@ namespace Draw {
 	string& Graph::operator()(const deque<long long>& data, bool data_same) {
 		if (data_same) return out;
 
+		//? setTheme() rebuilds the gradients, resolve the pointer again if the theme changed since the graph was created
+		if (theme_generation != Theme::generation) {
+			theme_generation = Theme::generation;
+			if (gradient != nullptr) gradient = &Theme::g(color_gradient);
+		}
+
 		//? Make room for new characters on graph
 		if (not tty_mode) current = not current;
-		for (const int& i : iota(0, height)) {
-			if (height == 1 and graphs.at(current).at(i).at(1) == '[') {
-				if (graphs.at(current).at(i).at(3) == 'C') graphs.at(current).at(i).erase(0, 4);
-				else graphs.at(current).at(i).erase(0, graphs.at(current).at(i).find_first_of('m') + 4);
-			}
-			else if (graphs.at(current).at(i).at(0) == ' ') graphs.at(current).at(i).erase(0, 1);
-			else graphs.at(current).at(i).erase(0, 3);
-		}
+		for (auto& row : rows[current]) row.pop();
 		this->_create(data, (int)data.size() - 1);
 		return out;
 	}
@@ -504,6 +563,314 @@ namespace Draw {
 	}
 	//*------------------------------------------------------------------------------------------------------------------------->
 
+	void Frame::resize(int width, int height) {
+		if (width == this->width and height == this->height) return;
+		this->width = max(0, width);
+		this->height = max(0, height);
+		cells.assign(this->width * this->height, Cell{});
+		shown.assign(cells.size(), Cell{});
+		invalid = true;
+	}
+
+	void Frame::erase(int from, int to) {
+		from = clamp(from, 0, (int)cells.size());
+		to = clamp(to, from, (int)cells.size());
+		//? Terminals fill erased cells with the current background color
+		std::fill(cells.begin() + from, cells.begin() + to, Cell{' ', 0, pen.bg, 0});
+	}
+
+	void Frame::put(uint64_t glyph, int glyph_width) {
+		if (line < 1 or line > height) return;
+
+		//? Combining characters are added to the glyph before the cursor if there is room left
+		if (glyph_width == 0) {
+			if (col < 2 or col > width + 1) return;
+			int i = (line - 1) * width + col - 2;
+			if (cells[i].attrs & WIDE_TAIL and col > 2) i--;
+			auto& prev = cells[i];
+			const int used = (std::bit_width(prev.glyph) + 7) / 8;
+			if (used + (std::bit_width(glyph) + 7) / 8 <= 8) prev.glyph |= glyph << (used * 8);
+			return;
+		}
+
+		if (col >= 1 and col + glyph_width - 1 <= width) {
+			const int i = (line - 1) * width + col - 1;
+			//? Overwriting half of a double width glyph clears the other half
+			if (cells[i].attrs & WIDE_TAIL and col > 1) cells[i - 1] = Cell{' ', cells[i - 1].fg, cells[i - 1].bg, 0};
+			if (col + glyph_width <= width and cells[i + glyph_width].attrs & WIDE_TAIL) cells[i + glyph_width] = Cell{' ', cells[i + glyph_width].fg, cells[i + glyph_width].bg, 0};
+
+			cells[i] = pen;
+			cells[i].glyph = glyph;
+			if (glyph_width == 2) {
+				cells[i + 1] = pen;
+				cells[i + 1].attrs |= WIDE_TAIL;
+			}
+		}
+		col += glyph_width;
+	}
+
+	void Frame::sgr(std::string_view params) {
+		//? Missing parameters count as 0, "\x1b[m" is a reset
+		array<int, 16> p{};
+		size_t count = 0;
+		for (size_t i = 0; i <= params.size() and count < p.size(); count++) {
+			const size_t end = min(params.find(';', i), params.size());
+			std::from_chars(params.data() + i, params.data() + end, p[count]);
+			i = end + 1;
+		}
+
+		for (size_t i = 0; i < count; i++) {
+			const int n = p[i];
+			if (n == 0) pen = Cell{};
+			else if (n == 1) pen.attrs |= BOLD;
+			else if (n == 2) pen.attrs |= DIM;
+			else if (n == 3) pen.attrs |= ITALIC;
+			else if (n == 4) pen.attrs |= UNDERLINE;
+			else if (n == 5) pen.attrs |= BLINK;
+			else if (n == 7) pen.attrs |= REVERSE;
+			else if (n == 9) pen.attrs |= STRIKE;
+			else if (n == 22) pen.attrs &= ~(BOLD | DIM);
+			else if (n == 23) pen.attrs &= ~ITALIC;
+			else if (n == 24) pen.attrs &= ~UNDERLINE;
+			else if (n == 25) pen.attrs &= ~BLINK;
+			else if (n == 27) pen.attrs &= ~REVERSE;
+			else if (n == 29) pen.attrs &= ~STRIKE;
+			else if (n >= 30 and n <= 37) pen.fg = COLOR_INDEX | (n - 30);
+			else if (n >= 40 and n <= 47) pen.bg = COLOR_INDEX | (n - 40);
+			else if (n >= 90 and n <= 97) pen.fg = COLOR_INDEX | (n - 82);
+			else if (n >= 100 and n <= 107) pen.bg = COLOR_INDEX | (n - 92);
+			else if (n == 39) pen.fg = 0;
+			else if (n == 49) pen.bg = 0;
+			else if ((n == 38 or n == 48) and i + 1 < count) {
+				auto& color = (n == 38 ? pen.fg : pen.bg);
+				if (p[i + 1] == 5 and i + 2 < count) {
+					color = COLOR_INDEX | (p[i + 2] & 0xff);
+					i += 2;
+				}
+				else if (p[i + 1] == 2 and i + 4 < count) {
+					color = COLOR_RGB | (p[i + 2] & 0xff) << 16 | (p[i + 3] & 0xff) << 8 | (p[i + 4] & 0xff);
+					i += 4;
+				}
+				else i++;
+			}
+		}
+	}
+
+	void Frame::csi(std::string_view params, char command) {
+		//? Private modes like synchronized output and mouse reporting don't change the screen
+		if (not params.empty() and params.front() == '?') return;
+		if (command == 'm') return sgr(params);
+
+		int n = 0, m = 0;
+		const size_t sep = min(params.find(';'), params.size());
+		std::from_chars(params.data(), params.data() + sep, n);
+		if (sep < params.size()) std::from_chars(params.data() + sep + 1, params.data() + params.size(), m);
+
+		switch (command) {
+			case 'f': case 'H': line = max(1, n); col = max(1, m); break;
+			case 'A': line = max(1, line - max(1, n)); break;
+			case 'B': line += max(1, n); break;
+			case 'C': col += max(1, n); break;
+			case 'D': col = max(1, col - max(1, n)); break;
+			case 'G': col = max(1, n); break;
+			case 's': saved_line = line; saved_col = col; break;
+			case 'u': line = saved_line; col = saved_col; break;
+			case 'J': {
+				const int cursor = (line - 1) * width + col - 1;
+				if (n == 0) erase(cursor, cells.size());
+				else if (n == 1) erase(0, cursor + 1);
+				else erase(0, cells.size());
+				break;
+			}
+			case 'K': {
+				const int start = (line - 1) * width;
+				if (line < 1 or line > height) break;
+				if (n == 0) erase(start + col - 1, start + width);
+				else if (n == 1) erase(start, start + col);
+				else erase(start, start + width);
+				break;
+			}
+			default: break;
+		}
+	}
+
+	void Frame::write(std::string_view out) {
+		size_t i = 0;
+		while (i < out.size()) {
+			const auto c = static_cast<unsigned char>(out[i]);
+			if (c == '\x1b') {
+				if (i + 1 < out.size() and out[i + 1] == '[') {
+					size_t end = i + 2;
+					while (end < out.size() and (out[end] < 0x40 or out[end] > 0x7e)) end++;
+					if (end == out.size()) return;
+					csi(out.substr(i + 2, end - i - 2), out[end]);
+					i = end + 1;
+				}
+				else i += 2;
+			}
+			else if (c < 0x20) {
+				if (c == '\n') { line++; col = 1; }
+				else if (c == '\r') col = 1;
+				i++;
+			}
+			else if (c < 0x80) {
+				put(c, 1);
+				i++;
+			}
+			else {
+				//? Decode the UTF-8 sequence for its width and store its bytes as the glyph
+				const size_t len = min<size_t>((c >= 0xf0 ? 4 : c >= 0xe0 ? 3 : c >= 0xc0 ? 2 : 1), out.size() - i);
+				uint32_t codepoint = (len == 1 ? c : c & (0x7f >> len));
+				uint64_t glyph = 0;
+				for (size_t b = 0; b < len; b++) {
+					if (b > 0) codepoint = codepoint << 6 | (out[i + b] & 0x3f);
+					glyph |= (uint64_t)static_cast<unsigned char>(out[i + b]) << (b * 8);
+				}
+				put(glyph, char_width(codepoint));
+				i += len;
+			}
+		}
+	}
+
+	string Frame::diff() {
+		string out;
+		if (invalid) {
+			style_known = false;
+			cursor_known = false;
+		}
+
+		//? Parameters for attributes and colors of <cell>, each prefixed with ';'
+		auto attr_codes = [](uint16_t attrs, bool on) {
+			string codes;
+			for (const auto& [attr, on_code, off_code] : {
+				std::tuple{BOLD, 1, 22}, {DIM, 2, 22}, {ITALIC, 3, 23}, {UNDERLINE, 4, 24}, {BLINK, 5, 25}, {REVERSE, 7, 27}, {STRIKE, 9, 29} }) {
+				if (attrs & attr) codes += ';' + to_string(on ? on_code : off_code);
+			}
+			return codes;
+		};
+		auto color_code = [](uint32_t color, int base) {
+			if (color & COLOR_RGB) return fmt::format(";{};2;{};{};{}", base + 8, color >> 16 & 0xff, color >> 8 & 0xff, color & 0xff);
+			if (not (color & COLOR_INDEX)) return ';' + to_string(base + 9);
+			const int index = color & 0xff;
+			if (index < 8) return ';' + to_string(base + index);
+			if (index < 16) return ';' + to_string(base + 52 + index);
+			return fmt::format(";{};5;{}", base + 8, index);
+		};
+
+		//? Change the terminal pen to <cell> with whichever is shorter of a full reset or only the parts that changed,
+		//? spaces without underline, reverse or strike only need the background
+		auto set_style = [&](const Cell& cell) {
+			constexpr uint16_t visible_on_blank = UNDERLINE | REVERSE | STRIKE;
+			const uint16_t attrs = cell.attrs & ~WIDE_TAIL;
+			const bool blank = (cell.glyph == ' ' and not (attrs & visible_on_blank) and not (style.attrs & visible_on_blank));
+			if (style_known and cell.bg == style.bg and (blank or (cell.fg == style.fg and attrs == style.attrs))) return;
+
+			string full = "\x1b[0" + attr_codes(attrs, true) + (cell.fg != 0 ? color_code(cell.fg, 30) : "") + (cell.bg != 0 ? color_code(cell.bg, 40) : "") + 'm';
+			Cell target = cell;
+			if (style_known) {
+				if (blank) target = Cell{0, style.fg, cell.bg, style.attrs};
+				string changes;
+				uint16_t added = target.attrs & ~style.attrs;
+				const uint16_t removed = style.attrs & ~target.attrs;
+				//? Bold and dim share their off code
+				if (removed & (BOLD | DIM)) added |= target.attrs & (BOLD | DIM);
+				changes += attr_codes(removed & ~DIM, false) + attr_codes(removed & DIM and not (removed & BOLD) ? BOLD : 0, false);
+				changes += attr_codes(added, true);
+				if (target.fg != style.fg) changes += color_code(target.fg, 30);
+				if (target.bg != style.bg) changes += color_code(target.bg, 40);
+				if (changes.size() + 2 < full.size()) full = "\x1b[" + changes.substr(1) + 'm';
+				else target = cell;
+			}
+			out += full;
+			style = target;
+			style.attrs &= ~WIDE_TAIL;
+			style_known = true;
+		};
+
+		//? Move the cursor with the shortest of absolute, column or relative moves
+		auto move_to = [&](int line, int col) {
+			if (cursor_known and line == cursor_line and col == cursor_col) return;
+			string best = (col == 1 ? fmt::format("\x1b[{}H", line) : fmt::format("\x1b[{};{}H", line, col));
+			if (cursor_known) {
+				auto relative = [](int n, char command) { return (n == 1 ? "\x1b["s + command : fmt::format("\x1b[{}{}", n, command)); };
+				auto consider = [&](string move) { if (move.size() < best.size()) best = std::move(move); };
+				if (line == cursor_line) {
+					consider(col == 1 ? "\x1b[G"s : fmt::format("\x1b[{}G", col));
+					consider(col > cursor_col ? relative(col - cursor_col, 'C') : relative(cursor_col - col, 'D'));
+				}
+				else if (col == cursor_col)
+					consider(line > cursor_line ? relative(line - cursor_line, 'B') : relative(cursor_line - line, 'A'));
+			}
+			out += best;
+			cursor_line = line;
+			cursor_col = col;
+			cursor_known = true;
+		};
+
+		auto changed = [&](int i) { return cells[i] != Cell{} and (invalid or cells[i] != shown[i]); };
+
+		for (int y = 0; y < height; y++) {
+			const int row = y * width;
+			int x = 0;
+			while (x < width) {
+				if (not changed(row + x)) { x++; continue; }
+				if (cells[row + x].attrs & WIDE_TAIL and x > 0) x--;
+
+				//? Extend the run over short gaps of unchanged cells when rewriting them is about as cheap as a cursor move
+				int end = x + 1;
+				for (int gap = 0; end < width and gap <= 2; end++) {
+					if (changed(row + end)) gap = 0;
+					else if (cells[row + end] == Cell{}) break;
+					else gap++;
+				}
+				while (end > x + 1 and not changed(row + end - 1) and not (cells[row + end - 1].attrs & WIDE_TAIL)) end--;
+
+				while (x < end) {
+					const auto& cell = cells[row + x];
+					if (cell.attrs & WIDE_TAIL) {
+						shown[row + x++] = cell;
+						continue;
+					}
+					const int cell_width = (x + 1 < width and cells[row + x + 1].attrs & WIDE_TAIL ? 2 : 1);
+					int same = 1;
+					while (x + same < end and cells[row + x + same] == cell) same++;
+
+					move_to(y + 1, x + 1);
+					set_style(cell);
+					string glyph;
+					for (uint64_t g = cell.glyph; g != 0; g >>= 8) glyph += static_cast<char>(g & 0xff);
+					//? REP only repeats the last codepoint written, so glyphs with combining marks are written out in full
+					const bool single_codepoint = (rng::count_if(glyph, [](char c) { return (static_cast<unsigned char>(c) & 0xC0) != 0x80; }) == 1);
+
+					//? Runs of the same cell are erased (default background blanks) or repeated (REP) when shorter
+					const string erase = fmt::format("\x1b[{}X", same);
+					const string repeat = fmt::format("\x1b[{}b", same - 1);
+					if (same > 1 and cell.glyph == ' ' and cell.bg == 0 and not (cell.attrs & (UNDERLINE | REVERSE | STRIKE))
+					and erase.size() + 4 < (size_t)same) {
+						out += erase;
+					}
+					else if (same > 1 and use_rep and cell_width == 1 and single_codepoint and glyph.size() + repeat.size() < glyph.size() * same) {
+						out += glyph + repeat;
+						cursor_col += same;
+					}
+					else {
+						same = 1;
+						out += glyph;
+						cursor_col += cell_width;
+					}
+					for (int i = 0; i < same; i++) shown[row + x + i] = cells[row + x + i];
+					x += same;
+				}
+
+				//? Cursor is left in a pending wrap state after writing the last column
+				if (cursor_col > width) cursor_known = false;
+			}
+		}
+
+		invalid = false;
+		return out;
+	}
+
 }
 
 namespace Cpu {
@@ -512,6 +879,8 @@ namespace Cpu {
 	int x = 1, y = 1, width = 20, height;
 	int b_columns, b_column_size;
 	int b_x, b_y, b_width, b_height;
+	bool core_grid = false;
+	int grid_label_width, grid_cells;
 	long unsigned int lavg_str_len = 0;
 	int graph_up_height, graph_low_height;
 	int graph_up_width, graph_low_width;
@@ -527,8 +896,82 @@ namespace Cpu {
 	vector<Draw::Graph> gpu_temp_graphs;
 	vector<Draw::Graph> gpu_mem_graphs;
 
-    string draw(const cpu_info& cpu, const vector<Gpu::gpu_info>& gpus, bool force_redraw, bool data_same) {
-		if (Runner::stopping) return "";
+	//* Interrupt and softirq rates per cpu drawn in place of the cpu graphs, busiest lines first
+	string draw_irq_matrix(const cpu_info& cpu, const int mx, const int my, const int mwidth, const int mheight) {
+		string out;
+		const int ncpu = cpu.irq_cpu_total.size();
+		if (mwidth < 20 or mheight < 2) return out;
+		const int label_width = min(14, mwidth / 3);
+		const int total_width = 6;
+		const int avail = mwidth - label_width - total_width;
+		const bool numeric = ncpu > 0 and ncpu * 5 <= avail;
+		//? Cpus per cell when every cpu can't get a numeric column, cells show the busiest cpu of the span
+		const int per_cell = (numeric or ncpu == 0 ? 1 : (ncpu + avail - 1) / avail);
+		const int cells = (numeric or ncpu == 0 ? ncpu : (ncpu + per_cell - 1) / per_cell);
+		const int used_width = label_width + total_width + cells * (numeric ? 5 : 1);
+
+		auto row = [&](const string& label, const string& label_color, const vector<long long>& rates) {
+			long long total = 0, row_max = 0;
+			for (const auto& v : rates) {
+				total += v;
+				row_max = max(row_max, v);
+			}
+			out += label_color + ljust(uresize(label, label_width - 1), label_width)
+				+ Theme::c("main_fg") + rjust(count_humanizer(total), total_width - 1) + ' ';
+			const string* last_color = nullptr;
+			for (int c = 0; c < cells; c++) {
+				long long v = 0;
+				for (int i = c * per_cell; i < min(ncpu, (c + 1) * per_cell) and cmp_less(i, rates.size()); i++) v = max(v, rates[i]);
+				const string& color = (v == 0 ? Theme::c("inactive_fg") : Theme::g("cpu").at(clamp(v * 100 / max(1ll, row_max), 0ll, 100ll)));
+				if (&color != last_color) out += color;
+				last_color = &color;
+				out += (numeric ? rjust(count_humanizer(v), 5) : Symbols::meter);
+			}
+			if (used_width < mwidth) out += string(mwidth - used_width, ' ');
+		};
+
+		//? Header with cpu numbers, or the cpu span covered by the cells
+		out += Mv::to(my, mx) + Theme::c("title") + Fx::b + ljust("Interrupts", label_width) + rjust("/s", total_width - 1) + ' ' + Fx::ub + Theme::c("main_fg");
+		if (numeric) {
+			for (int i = 0; i < ncpu; i++) out += rjust("C" + to_string(i), 5);
+		}
+		else if (cells > 0) {
+			const string span = "cpu 0-" + to_string(ncpu - 1) + (per_cell > 1 ? " (" + to_string(per_cell) + "/cell)" : "");
+			out += ljust(uresize(span, cells), cells);
+		}
+		if (used_width < mwidth) out += string(mwidth - used_width, ' ');
+
+		//? Sum of hardware interrupts per cpu
+		out += Mv::to(my + 1, mx);
+		row("all irqs", Theme::c("title"), cpu.irq_cpu_total);
+
+		int line = 2;
+		for (const auto& index : cpu.irq_order) {
+			if (line >= mheight) break;
+			const auto& irq = cpu.irqs.at(index);
+			if (irq.total == 0) break;
+			string label = irq.name;
+			//? Numbered lines are labeled with the name of the device handling them
+			if (not irq.softirq and not irq.name.empty() and isdigit(irq.name.front())) {
+				const auto space = irq.desc.find_last_of(' ');
+				label += ' ' + (space == string::npos ? irq.desc : irq.desc.substr(space + 1));
+			}
+			else if (irq.softirq) label = str_to_lower(label);
+			//? Color labels by the share of the rate handled by the busiest cpu to show imbalance
+			long long irq_max = 0;
+			for (const auto& v : irq.rates) irq_max = max(irq_max, v);
+			const string& label_color = (ncpu > 1 ? Theme::g("cpu").at(clamp(irq_max * 100 / max(1ll, irq.total), 0ll, 100ll)) : Theme::c("main_fg"));
+			out += Mv::to(my + line++, mx);
+			row(label, label_color, irq.rates);
+		}
+		for (; line < mheight; line++)
+			out += Mv::to(my + line, mx) + string(mwidth, ' ');
+
+		return out;
+	}
+
+    void draw(string& out, const cpu_info& cpu, const vector<Gpu::gpu_info>& gpus, bool force_redraw, bool data_same) {
+		if (Runner::stopping) return;
 		if (force_redraw) redraw = true;
 		bool show_temps = (Config::getB("check_temp") and got_sensors);
 		auto single_graph = Config::getB("cpu_single_graph");
@@ -557,22 +1000,24 @@ namespace Cpu {
 		auto& graph_bg = Symbols::graph_symbols.at((graph_symbol == "default" ? Config::getS("graph_symbol") + "_up" : graph_symbol + "_up")).at(6);
 		auto& temp_scale = Config::getS("temp_scale");
 		auto cpu_bottom = Config::getB("cpu_bottom");
+		const bool irq_matrix = Config::getB("cpu_irq_matrix");
 
-		const string& title_left = Theme::c("cpu_box") + (cpu_bottom ? Symbols::title_left_down : Symbols::title_left);
-		const string& title_right = Theme::c("cpu_box") + (cpu_bottom ? Symbols::title_right_down : Symbols::title_right);
+		static string title_left, title_right;
+		if (redraw) {
+			title_left = Theme::c("cpu_box") + (cpu_bottom ? Symbols::title_left_down : Symbols::title_left);
+			title_right = Theme::c("cpu_box") + (cpu_bottom ? Symbols::title_right_down : Symbols::title_right);
+		}
 		static int bat_pos = 0, bat_len = 0;
 		if (safeVal(cpu.cpu_percent, "total"s).empty()
 			or safeVal(cpu.core_percent, 0).empty()
-			or (show_temps and safeVal(cpu.temp, 0).empty())) return "";
+			or (show_temps and safeVal(cpu.temp, 0).empty())) return;
 		if (safeVal(cpu.cpu_percent, "total"s).empty()
 			or safeVal(cpu.core_percent, 0).empty()
-			or (show_temps and safeVal(cpu.temp, 0).empty())) return "";
-		string out;
-		out.reserve(width * height);
+			or (show_temps and safeVal(cpu.temp, 0).empty())) return;
 
 		//* Redraw elements not needed to be updated every cycle
 		if (redraw) {
-			mid_line = (not single_graph and graph_up_field != graph_lo_field);
+			mid_line = (not single_graph and not irq_matrix and graph_up_field != graph_lo_field);
 			graph_up_height = (single_graph ? height - 2 : ceil((double)(height - 2) / 2) - (mid_line and height % 2 != 0));
 			graph_low_height = height - 2 - graph_up_height - mid_line;
 			const int button_y = cpu_bottom ? y + height - 1 : y;
@@ -684,7 +1129,7 @@ namespace Cpu {
 					+ Theme::c("main_fg") + graph_up_field + Mv::r(1) + "▲▼" + Mv::r(1) + graph_lo_field;
 			}
 
-			if (b_column_size > 0 or extra_width > 0) {
+			if (not core_grid and (b_column_size > 0 or extra_width > 0)) {
 				core_graphs.clear();
 				for (const auto& core_data : cpu.core_percent) {
 					core_graphs.emplace_back(5 * b_column_size + extra_width, 1, "cpu", core_data, graph_symbol);
@@ -694,7 +1139,7 @@ namespace Cpu {
 			if (show_temps) {
 				temp_graphs.clear();
 				temp_graphs.emplace_back(5, 1, "temp", safeVal(cpu.temp, 0), graph_symbol, false, false, cpu.temp_max, -23);
-				if (not hide_cores and b_column_size > 1) {
+				if (not hide_cores and not core_grid and b_column_size > 1) {
 					for (const auto& i : iota((size_t)1, cpu.temp.size())) {
 						temp_graphs.emplace_back(5, 1, "temp", safeVal(cpu.temp, i), graph_symbol, false, false, cpu.temp_max, -23);
 					}
@@ -774,66 +1219,188 @@ namespace Cpu {
 				out += graphs[0](safeVal(cpu.cpu_percent, graph_field), (data_same or redraw));
 		};
 
-		draw_graphs(graphs_upper, graph_up_height, graph_up_width, graph_up_field);
-		if (not single_graph) {
-			out += Mv::to(y + graph_up_height + 1 + mid_line, x + 1);
-			draw_graphs(graphs_lower, graph_low_height, graph_low_width, graph_lo_field);
+		if (irq_matrix)
+			out += draw_irq_matrix(cpu, x + 1, y + 1, width - b_width - 2, height - 2);
+		else {
+			draw_graphs(graphs_upper, graph_up_height, graph_up_width, graph_up_field);
+			if (not single_graph) {
+				out += Mv::to(y + graph_up_height + 1 + mid_line, x + 1);
+				draw_graphs(graphs_lower, graph_low_height, graph_low_width, graph_lo_field);
+			}
+
+			//? Current power draw when a RAPL field is graphed
+			auto draw_watts = [&](const string& field, int line) {
+				if (not cpu.power_watts.contains(field)) return;
+				const string watts = fmt::format("{:.1f}W", cpu.power_watts.at(field));
+				out += Mv::to(line, x + width - b_width - 2 - (int)watts.size()) + Theme::c("graph_text") + watts;
+			};
+			draw_watts(graph_up_field, y + 1);
+			if (not single_graph and graph_lo_field != graph_up_field)
+				draw_watts(graph_lo_field, (Config::getB("cpu_invert_lower") ? y + height - 2 : y + graph_up_height + 1 + mid_line));
 		}
 
 		//? Uptime
-		if (Config::getB("show_uptime")) {
+		if (Config::getB("show_uptime") and not irq_matrix) {
 			string upstr = sec_to_dhms(system_uptime());
 			if (upstr.size() > 8) {
 				upstr.resize(upstr.size() - 3);
 				upstr = trans(upstr);
 			}
-			out += Mv::to(y + (single_graph or not Config::getB("cpu_invert_lower") ? 1 : height - 2), x + 2)
-				+ Theme::c("graph_text") + "up" + Mv::r(1) + upstr;
+			Mv::to(out, y + (single_graph or not Config::getB("cpu_invert_lower") ? 1 : height - 2), x + 2);
+			out += Theme::c("graph_text");
+			out += "up";
+			Mv::r(out, 1);
+			out += upstr;
 		}
 
 		//? Cpu clock and cpu meter
-		if (Config::getB("show_cpu_freq") and not cpuHz.empty())
-			out += Mv::to(b_y, b_x + b_width - 10) + Fx::ub + Theme::c("div_line") + Symbols::h_line * (7 - cpuHz.size())
-				+ Symbols::title_left + Fx::b + Theme::c("title") + cpuHz + Fx::ub + Theme::c("div_line") + Symbols::title_right;
-
-		out += Mv::to(b_y + 1, b_x + 1) + Theme::c("main_fg") + Fx::b + "CPU " + cpu_meter(safeVal(cpu.cpu_percent, "total"s).back())
-			+ Theme::g("cpu").at(clamp(safeVal(cpu.cpu_percent, "total"s).back(), 0ll, 100ll)) + rjust(to_string(safeVal(cpu.cpu_percent, "total"s).back()), 4) + Theme::c("main_fg") + '%';
+		if (Config::getB("show_cpu_freq") and not cpuHz.empty()) {
+			Mv::to(out, b_y, b_x + b_width - 10);
+			out += Fx::ub;
+			out += Theme::c("div_line");
+			for (size_t i = cpuHz.size(); i < 7; i++) out += Symbols::h_line;
+			out += Symbols::title_left;
+			out += Fx::b;
+			out += Theme::c("title");
+			out += cpuHz;
+			out += Fx::ub;
+			out += Theme::c("div_line");
+			out += Symbols::title_right;
+		}
+
+		const long long cpu_total = safeVal(cpu.cpu_percent, "total"s).back();
+		Mv::to(out, b_y + 1, b_x + 1);
+		out += Theme::c("main_fg");
+		out += Fx::b;
+		out += "CPU ";
+		out += cpu_meter(cpu_total);
+		out += Theme::g("cpu").at(clamp(cpu_total, 0ll, 100ll));
+		rjust_to(out, to_string(cpu_total), 4);
+		out += Theme::c("main_fg");
+		out += '%';
 		if (show_temps) {
 			const auto [temp, unit] = celsius_to(safeVal(cpu.temp, 0).back(), temp_scale);
 			const auto& temp_color = Theme::g("temp").at(clamp(safeVal(cpu.temp, 0).back() * 100 / cpu.temp_max, 0ll, 100ll));
-			if ((b_column_size > 1 or b_columns > 1) and temp_graphs.size() >= 1ll)
-				out += ' ' + Theme::c("inactive_fg") + graph_bg * 5 + Mv::l(5) + temp_color
-					+ temp_graphs.at(0)(safeVal(cpu.temp, 0), data_same or redraw);
-			out += rjust(to_string(temp), 4) + Theme::c("main_fg") + unit;
+			if ((b_column_size > 1 or b_columns > 1) and temp_graphs.size() >= 1ll) {
+				out += ' ';
+				out += Theme::c("inactive_fg");
+				for (int i = 0; i < 5; i++) out += graph_bg;
+				Mv::l(out, 5);
+				out += temp_color;
+				out += temp_graphs.at(0)(safeVal(cpu.temp, 0), data_same or redraw);
+			}
+			rjust_to(out, to_string(temp), 4);
+			out += Theme::c("main_fg");
+			out += unit;
 		}
-		out += Theme::c("div_line") + Symbols::v_line;
+		out += Theme::c("div_line");
+		out += Symbols::v_line;
 
 		} catch (const std::exception& e) { throw std::runtime_error("graphs, clock, meter : " + string{e.what()}); }
 
 		//? Core text and graphs
 		int cx = 0, cy = 1, cc = 0, core_width = (b_column_size == 0 ? 2 : 3);
 		if (Shared::coreCount >= 100) core_width++;
-		for (const auto& n : iota(0, Shared::coreCount)) {
+		const bool show_core_freq = Config::getB("show_core_freq") and 5 * b_column_size + extra_width >= 5;
+		const long long max_core_freq = (show_core_freq and not cpu.core_freq.empty() ? rng::max(cpu.core_freq) : 0);
+		if (core_grid) {
+			//? One colored cell per core, with the group label and average usage in front of the first row of each group
+		#ifdef GPU_SUPPORT
+			const int max_cy = b_height - 3 - (show_gpu ? (gpus.size() - (gpu_always ? 0 : Gpu::shown)) : 0);
+		#else
+			const int max_cy = b_height - 3;
+		#endif
+			static vector<core_group> all_cores;
+			if (core_groups.empty() and (all_cores.empty() or cmp_less(all_cores[0].cores.size(), Shared::coreCount))) {
+				all_cores = {{"", {}}};
+				for (const auto& n : iota(0, Shared::coreCount)) all_cores[0].cores.push_back(n);
+			}
+			const auto& groups = (core_groups.empty() ? all_cores : core_groups);
+			const auto& cpu_gradient = Theme::g("cpu");
+			for (size_t g = 0; g < groups.size() and cy <= max_cy; g++) {
+				const auto& cores = groups[g].cores;
+				for (size_t c = 0; c < cores.size() and cy <= max_cy; c += grid_cells, cy++) {
+					out += Mv::to(b_y + cy + 1, b_x + 1);
+					if (grid_label_width > 0 and c == 0) {
+						const long long percent = clamp(safeVal(cpu.group_percent, g), 0ll, 100ll);
+						out += Theme::c("main_fg") + Fx::b + ljust(groups[g].label, grid_label_width - 6) + Fx::ub + ' '
+							+ cpu_gradient.at(percent) + rjust(to_string(percent), 3) + Theme::c("main_fg") + "% ";
+					}
+					else if (grid_label_width > 0)
+						out += Mv::r(grid_label_width);
+
+					const string* last_color = nullptr;
+					for (size_t i = c; i < min(c + grid_cells, cores.size()); i++) {
+						const auto& core_data = safeVal(cpu.core_percent, cores[i]);
+						const auto& color = cpu_gradient.at(core_data.empty() ? 0 : clamp(core_data.back(), 0ll, 100ll));
+						if (&color != last_color) {
+							out += color;
+							last_color = &color;
+						}
+						out += Symbols::meter;
+					}
+				}
+			}
+			cy = max_cy + 1;
+		}
+
+		for (const auto& n : iota(0, (core_grid ? 0 : Shared::coreCount))) {
 			if (cmp_less(core_graphs.size(), n+1)) break;
-			out += Mv::to(b_y + cy + 1, b_x + cx + 1) + Theme::c("main_fg") + (Shared::coreCount < 100 ? Fx::b + 'C' + Fx::ub : "")
-				+ ljust(to_string(n), core_width);
-			if (b_column_size > 0 or extra_width > 0)
-				out += Theme::c("inactive_fg") + graph_bg * (5 * b_column_size + extra_width) + Mv::l(5 * b_column_size + extra_width)
-					+ core_graphs.at(n)(safeVal(cpu.core_percent, n), data_same or redraw);
+			Mv::to(out, b_y + cy + 1, b_x + cx + 1);
+			out += Theme::c("main_fg");
+			if (Shared::coreCount < 100) {
+				out += Fx::b;
+				out += 'C';
+				out += Fx::ub;
+			}
+			ljust_to(out, to_string(n), core_width);
+			if (show_core_freq and cmp_less(n, cpu.core_freq.size())) {
+				//? Frequency colored by percent of max frequency, "!" marks thermal throttling since last update
+				const long long mhz = cpu.core_freq.at(n);
+				const long long max_mhz = (cpu.core_freq_max.at(n) > 0 ? cpu.core_freq_max.at(n) : max_core_freq);
+				const bool throttled = cpu.core_throttle.at(n) > 0;
+				const string freq_str = (mhz <= 0 ? "-" : (mhz >= 1000 ? fmt::format("{:.1f}G", mhz / 1000.0) : to_string(mhz) + 'M'));
+				const int freq_width = 5 * b_column_size + extra_width;
+				if (throttled) {
+					out += Theme::g("temp").at(100);
+					out += '!';
+				}
+				else
+					out += ' ';
+				out += Theme::g("cpu").at(max_mhz > 0 ? clamp(mhz * 100 / max_mhz, 0ll, 100ll) : 0);
+				rjust_to(out, freq_str, freq_width - 1);
+			}
+			else if (b_column_size > 0 or extra_width > 0) {
+				out += Theme::c("inactive_fg");
+				for (int i = 0; i < 5 * b_column_size + extra_width; i++) out += graph_bg;
+				Mv::l(out, 5 * b_column_size + extra_width);
+				out += core_graphs.at(n)(safeVal(cpu.core_percent, n), data_same or redraw);
+			}
 
-			out += Theme::g("cpu").at(clamp(safeVal(cpu.core_percent, n).back(), 0ll, 100ll));
-			out += rjust(to_string(safeVal(cpu.core_percent, n).back()), (b_column_size < 2 ? 3 : 4)) + Theme::c("main_fg") + '%';
+			const long long core_total = safeVal(cpu.core_percent, n).back();
+			out += Theme::g("cpu").at(clamp(core_total, 0ll, 100ll));
+			rjust_to(out, to_string(core_total), (b_column_size < 2 ? 3 : 4));
+			out += Theme::c("main_fg");
+			out += '%';
 
 			if (show_temps and not hide_cores and std::cmp_greater_equal(temp_graphs.size(), n)) {
 				const auto [temp, unit] = celsius_to(safeVal(cpu.temp, n+1).back(), temp_scale);
 				const auto& temp_color = Theme::g("temp").at(clamp(safeVal(cpu.temp, n+1).back() * 100 / cpu.temp_max, 0ll, 100ll));
-				if (b_column_size > 1)
-					out += ' ' + Theme::c("inactive_fg") + graph_bg * 5 + Mv::l(5)
-						+ temp_graphs.at(n+1)(safeVal(cpu.temp, n+1), data_same or redraw);
-				out += temp_color + rjust(to_string(temp), 4) + Theme::c("main_fg") + unit;
+				if (b_column_size > 1) {
+					out += ' ';
+					out += Theme::c("inactive_fg");
+					for (int i = 0; i < 5; i++) out += graph_bg;
+					Mv::l(out, 5);
+					out += temp_graphs.at(n+1)(safeVal(cpu.temp, n+1), data_same or redraw);
+				}
+				out += temp_color;
+				rjust_to(out, to_string(temp), 4);
+				out += Theme::c("main_fg");
+				out += unit;
 			}
 
-			out += Theme::c("div_line") + Symbols::v_line;
+			out += Theme::c("div_line");
+			out += Symbols::v_line;
 
 			if ((++cy > ceil((double)Shared::coreCount / b_columns) or cy == b_height - 2) and n != Shared::coreCount - 1) {
 				if (++cc >= b_columns) break;
@@ -872,7 +1439,9 @@ namespace Cpu {
 		#else
 			cy = b_height - 2;
 		#endif
-			out += Mv::to(b_y + cy, b_x + cx + 1) + Theme::c("main_fg") + lavg_str;
+			Mv::to(out, b_y + cy, b_x + cx + 1);
+			out += Theme::c("main_fg");
+			out += lavg_str;
 		}
 
 	#ifdef GPU_SUPPORT
@@ -915,7 +1484,7 @@ namespace Cpu {
 	#endif
 
 		redraw = false;
-		return out + Fx::reset;
+		out += Fx::reset;
 	}
 
 }
@@ -939,8 +1508,8 @@ namespace Gpu {
 	vector<Draw::Meter> pwr_meter_vec = {};
 	vector<string> box = {};
 
-    string draw(const gpu_info& gpu, unsigned long index, bool force_redraw, bool data_same) {
-		if (Runner::stopping) return "";
+    void draw(string& out, const gpu_info& gpu, unsigned long index, bool force_redraw, bool data_same) {
+		if (Runner::stopping) return;
 
 		auto& b_x = b_x_vec[index];
 		auto& b_y = b_y_vec[index];
@@ -962,8 +1531,6 @@ namespace Gpu {
 		auto& graph_symbol = (tty_mode ? "tty" : Config::getS("graph_symbol_gpu"));
 		auto& graph_bg = Symbols::graph_symbols.at((graph_symbol == "default" ? Config::getS("graph_symbol") + "_up" : graph_symbol + "_up")).at(6);
         auto single_graph = !Config::getB("gpu_mirror_graph");
-		string out;
-		out.reserve(width * height);
 
 		//* Redraw elements not needed to be updated every cycle
 		if (redraw[index]) {
@@ -1086,7 +1653,7 @@ namespace Gpu {
 		}
 
 		redraw[index] = false;
-		return out + Fx::reset;
+		out += Fx::reset;
 	}
 
 }
@@ -1106,23 +1673,42 @@ namespace Mem {
 	std::unordered_map<string, Draw::Meter> disk_meters_used;
 	std::unordered_map<string, Draw::Meter> disk_meters_free;
 	std::unordered_map<string, Draw::Graph> io_graphs;
-
-	string draw(const mem_info& mem, bool force_redraw, bool data_same) {
-		if (Runner::stopping) return "";
+	vector<Draw::Meter> numa_meters;
+	std::unordered_map<string, long long> io_graph_max;
+
+	//* Values for the small per disk io graph selected with io_graph_stat
+	const deque<long long>& io_stat_values(const disk_info& disk, const string& io_stat) {
+		if (io_stat == "iops") return disk.io_iops;
+		else if (io_stat == "await") return disk.io_await;
+		else if (io_stat == "queue") return disk.io_queue;
+		else if (io_stat == "discard") return disk.io_discard;
+		return disk.io_activity;
+	}
+	array<Draw::Graph, KERNEL_COUNT> kernel_graphs;
+	array<long long, KERNEL_COUNT> kernel_graph_max{};	// Scale of each graph in kernel_graphs, 0 until created
+	Draw::Meter swap_meter;
+	Draw::Graph swap_ratio_graph;
+	long long swap_ratio_max{};
+	int swap_graph_height{};
+
+	void draw(string& out, const mem_info& mem, bool force_redraw, bool data_same) {
+		if (Runner::stopping) return;
 		if (force_redraw) redraw = true;
 		auto show_swap = Config::getB("show_swap");
 		auto swap_disk = Config::getB("swap_disk");
 		auto show_disks = Config::getB("show_disks");
 		auto show_io_stat = Config::getB("show_io_stat");
 		auto io_mode = Config::getB("io_mode");
+		auto& io_stat = Config::getS("io_graph_stat");
+		const bool io_stat_scaled = io_stat != "activity";
+		const int io_stat_width = disks_width - 6 - (io_stat_scaled ? 6 : 0);
 		auto io_graph_combined = Config::getB("io_graph_combined");
 		auto use_graphs = Config::getB("mem_graphs");
+		auto& mem_panel = Config::getS("mem_panel");
 		auto tty_mode = Config::getB("tty_mode");
 		auto& graph_symbol = (tty_mode ? "tty" : Config::getS("graph_symbol_mem"));
 		auto& graph_bg = Symbols::graph_symbols.at((graph_symbol == "default" ? Config::getS("graph_symbol") + "_up" : graph_symbol + "_up")).at(6);
 		auto totalMem = Mem::get_totalMem();
-		string out;
-		out.reserve(height * width);
 
 		//* Redraw elements not needed to be updated every cycle
 		if (redraw) {
@@ -1132,23 +1718,35 @@ namespace Mem {
 			disk_meters_free.clear();
 			disk_meters_used.clear();
 			io_graphs.clear();
+			numa_meters.clear();
+			kernel_graph_max.fill(0);
 
 			//? Mem graphs and meters
-			for (const auto& name : mem_names) {
-
+			for (const auto& stat : mem_names) {
+				const auto& name = stat_names[stat];
 				if (use_graphs)
 					mem_graphs[name] = Draw::Graph{mem_meter, graph_height, name, safeVal(mem.percent, name), graph_symbol};
 				else
 					mem_meters[name] = Draw::Meter{mem_meter, name};
 			}
 			if (show_swap and has_swap) {
-				for (const auto& name : swap_names) {
+				for (const auto& stat : swap_names) {
+					const auto& name = stat_names[stat];
 					if (use_graphs)
 						mem_graphs[name] = Draw::Graph{mem_meter, graph_height, name.substr(5), safeVal(mem.percent, name), graph_symbol};
 					else
 						mem_meters[name] = Draw::Meter{mem_meter, name.substr(5)};
 				}
 			}
+			//? Extra values have no theme gradients of their own and use the one for cached memory
+			for (const auto& stat : mem.extra_stats) {
+				const auto& name = stat_names[stat];
+				if (safeVal(mem.percent, name).empty()) continue;
+				if (use_graphs)
+					mem_graphs[name] = Draw::Graph{mem_meter, graph_height, "cached", safeVal(mem.percent, name), graph_symbol};
+				else
+					mem_meters[name] = Draw::Meter{mem_meter, "cached"};
+			}
 
 			//? Disk meters and io graphs
 			if (show_disks) {
@@ -1175,7 +1773,11 @@ namespace Mem {
 					for (const auto& [name, disk] : mem.disks) {
 						if (disk.io_read.empty()) continue;
 
-						io_graphs[name + "_activity"] = Draw::Graph{disks_width - 6, 1, "available", disk.io_activity, graph_symbol};
+						const auto& io_values = io_stat_values(disk, io_stat);
+						if (not io_values.empty()) {
+							io_graph_max[name] = (io_stat_scaled ? max(1ll, rng::max(io_values)) : 0);
+							io_graphs[name + "_activity"] = Draw::Graph{io_stat_width, 1, "available", io_values, graph_symbol, false, false, io_graph_max[name]};
+						}
 
 						if (io_mode) {
 							//? Create one combined graph for IO read/write if enabled
@@ -1212,66 +1814,316 @@ namespace Mem {
 				out += Mv::to(y, x + width - 6) + Fx::ub + Theme::c("mem_box") + Symbols::title_left + (io_mode ? Fx::b : "") + Theme::c("hi_fg")
 				+ 'i' + Theme::c("title") + 'o' + Fx::ub + Theme::c("mem_box") + Symbols::title_right;
 				Input::mouse_mappings["i"] = {y, x + width - 5, 1, 2};
+
+				for (size_t i = 0; i < mem.numa.size(); i++)
+					numa_meters.emplace_back(disk_meter, "used");
+				swap_meter = Draw::Meter{disk_meter, "used"};
 			}
 
 		}
 
 		//? Mem and swap
 		int cx = 1, cy = 1;
-		string divider = (graph_height > 0 ? Mv::l(2) + Theme::c("mem_box") + Symbols::div_left + Theme::c("div_line") + Symbols::h_line * (mem_width - 1)
-						+ (show_disks ? "" : Theme::c("mem_box")) + Symbols::div_right + Mv::l(mem_width - 1) + Theme::c("main_fg") : "");
-		string up = (graph_height >= 2 ? Mv::l(mem_width - 2) + Mv::u(graph_height - 1) : "");
+		//? Dividers are rebuilt in place every update, static to keep the buffers between updates
+		static string divider, up;
+		divider.clear();
+		if (graph_height > 0) {
+			Mv::l(divider, 2);
+			divider += Theme::c("mem_box");
+			divider += Symbols::div_left;
+			divider += Theme::c("div_line");
+			for (int i = 0; i < mem_width - 1; i++) divider += Symbols::h_line;
+			if (not show_disks) divider += Theme::c("mem_box");
+			divider += Symbols::div_right;
+			Mv::l(divider, mem_width - 1);
+			divider += Theme::c("main_fg");
+		}
+		up = (graph_height >= 2 ? Mv::l(mem_width - 2) + Mv::u(graph_height - 1) : "");
 		bool big_mem = mem_width > 21;
 
-		out += Mv::to(y + 1, x + 2) + Theme::c("title") + Fx::b + "Total:" + rjust(floating_humanizer(totalMem), mem_width - 9) + Fx::ub + Theme::c("main_fg");
-		vector<string> comb_names (mem_names.begin(), mem_names.end());
+		auto set_panel_divider = [&] {
+			divider.clear();
+			Mv::l(divider, 1);
+			divider += Theme::c("div_line");
+			divider += Symbols::div_left;
+			for (int i = 0; i < disks_width; i++) divider += Symbols::h_line;
+			divider += Theme::c("mem_box");
+			divider += Fx::ub;
+			divider += Symbols::div_right;
+			Mv::l(divider, disks_width);
+		};
+
+		Mv::to(out, y + 1, x + 2);
+		out += Theme::c("title");
+		out += Fx::b;
+		out += "Total:";
+		rjust_to(out, floating_humanizer(totalMem), mem_width - 9);
+		out += Fx::ub;
+		out += Theme::c("main_fg");
+		static const std::unordered_map<Stat, string> extra_titles = {
+			{DIRTY, "Dirty"}, {WRITEBACK, "Writeback"}, {SHMEM, "Shmem"}, {SLAB_RECLAIMABLE, "SReclaim"}, {SLAB_UNRECLAIMABLE, "SUnreclaim"},
+			{ANON_HUGEPAGES, "AnonHuge"}, {HUGEPAGES_TOTAL, "HugeTotal"}, {HUGEPAGES_FREE, "HugeFree"}, {MLOCKED, "Mlocked"}
+		};
+		vector<Stat> comb_names (mem_names.begin(), mem_names.end());
+		for (const auto& stat : mem.extra_stats)
+			if (not safeVal(mem.percent, stat_names[stat]).empty()) comb_names.push_back(stat);
 		if (show_swap and has_swap and not swap_disk) comb_names.insert(comb_names.end(), swap_names.begin(), swap_names.end());
-		for (auto name : comb_names) {
+		for (const auto& stat : comb_names) {
 			if (cy > height - 4) break;
+			const auto& name = stat_names[stat];
 			string title;
-			if (name == "swap_used") {
+			if (stat == SWAP_USED) {
 				if (cy > height - 5) break;
 				if (height - cy > 6) {
 					if (graph_height > 0) out += Mv::to(y+1+cy, x+1+cx) + divider;
 					cy += 1;
 				}
-				out += Mv::to(y+1+cy, x+1+cx) + Theme::c("title") + Fx::b + "Swap:" + rjust(floating_humanizer(safeVal(mem.stats, "swap_total"s)), mem_width - 8)
+				out += Mv::to(y+1+cy, x+1+cx) + Theme::c("title") + Fx::b + "Swap:" + rjust(floating_humanizer(mem.stats[SWAP_TOTAL]), mem_width - 8)
 					+ Theme::c("main_fg") + Fx::ub;
 				cy += 1;
 				title = "Used";
 			}
-			else if (name == "swap_free")
+			else if (stat == SWAP_FREE)
 				title = "Free";
+			else if (extra_titles.contains(stat))
+				title = extra_titles.at(stat);
 
 			if (title.empty()) title = capitalize(name);
-			const string humanized = floating_humanizer(safeVal(mem.stats, name));
+			const string humanized = floating_humanizer(mem.stats[stat]);
 			const int offset = max(0, divider.empty() ? 9 - (int)humanized.size() : 0);
-			const string graphics = (
+			const string& graphics = (
 				use_graphs and mem_graphs.contains(name) ? mem_graphs.at(name)(safeVal(mem.percent, name), redraw or data_same)
 				: mem_meters.contains(name) ? mem_meters.at(name)(safeVal(mem.percent, name).back())
-				: "");
+				: default_value<string>());
 			if (mem_size > 2) {
-				out += Mv::to(y+1+cy, x+1+cx) + divider + title.substr(0, big_mem ? 10 : 5) + ":"
-					+ Mv::to(y+1+cy, x+cx + mem_width - 2 - humanized.size()) + (divider.empty() ? Mv::l(offset) + string(" ") * offset + humanized : trans(humanized))
-					+ Mv::to(y+2+cy, x+cx + (graph_height >= 2 ? 0 : 1)) + graphics + up + rjust(to_string(safeVal(mem.percent, name).back()) + "%", 4);
+				Mv::to(out, y+1+cy, x+1+cx);
+				out += divider;
+				out.append(title, 0, big_mem ? 10 : 5);
+				out += ':';
+				Mv::to(out, y+1+cy, x+cx + mem_width - 2 - humanized.size());
+				if (divider.empty()) {
+					Mv::l(out, offset);
+					out.append(offset, ' ');
+					out += humanized;
+				}
+				else
+					out += trans(humanized);
+				Mv::to(out, y+2+cy, x+cx + (graph_height >= 2 ? 0 : 1));
+				out += graphics;
+				out += up;
+				rjust_to(out, to_string(safeVal(mem.percent, name).back()) + "%", 4);
 				cy += (graph_height == 0 ? 2 : graph_height + 1);
 			}
 			else {
-				out += Mv::to(y+1+cy, x+1+cx) + ljust(title, (mem_size > 1 ? 5 : 1)) + (graph_height >= 2 ? "" : " ")
-					+ graphics + Theme::c("title") + rjust(humanized, (mem_size > 1 ? 9 : 7));
+				Mv::to(out, y+1+cy, x+1+cx);
+				ljust_to(out, title, (mem_size > 1 ? 5 : 1));
+				if (graph_height < 2) out += ' ';
+				out += graphics;
+				out += Theme::c("title");
+				rjust_to(out, humanized, (mem_size > 1 ? 9 : 7));
 				cy += (graph_height == 0 ? 1 : graph_height);
 			}
 		}
-		if (graph_height > 0 and cy < height - 2)
-			out += Mv::to(y+1+cy, x+1+cx) + divider;
+		if (graph_height > 0 and cy < height - 2) {
+			Mv::to(out, y+1+cy, x+1+cx);
+			out += divider;
+		}
+
+		//? NUMA nodes
+		if (show_disks and mem_panel == "numa") {
+			cx = mem_width; cy = 0;
+			const bool big_numa = disks_width >= 31;
+			set_panel_divider();
+			if (mem.numa.empty())
+				out += Mv::to(y+1, x+1+cx) + Theme::c("inactive_fg") + uresize(" No NUMA information", disks_width);
+			for (size_t i = 0; i < mem.numa.size() and cmp_less(i, numa_meters.size()); i++) {
+				if (cy > height - 3) break;
+				const auto& numa = mem.numa[i];
+				const string human_total = floating_humanizer(numa.total, not big_numa);
+				out += Mv::to(y+1+cy, x+1+cx) + divider + Theme::c("title") + Fx::b + "Node " + to_string(numa.node)
+					+ Mv::to(y+1+cy, x+cx + disks_width - human_total.size()) + trans(human_total) + Fx::ub + Theme::c("main_fg");
+				if (++cy > height - 3) break;
+
+				out += Mv::to(y+1+cy, x+1+cx) + (disks_width >= 25 ? " Used:" + rjust(to_string(numa.used_percent) + '%', 4) : "U") + ' '
+					+ numa_meters[i](numa.used_percent) + rjust(floating_humanizer(numa.used, disks_width < 25), (disks_width >= 25 ? 9 : 5));
+				if (++cy > height - 3) break;
+
+				//? Memory allocated per second on this node that was intended for it (hit), intended for another node (miss) or intended for this node but placed elsewhere (foreign)
+				const auto& [hit, miss, foreign] = numa.rates;
+				if (big_numa)
+					out += Mv::to(y+1+cy, x+1+cx) + fmt::format(" Hit {:>5} Miss {:>5} For {:>5}",
+						floating_humanizer(hit, true), floating_humanizer(miss, true), floating_humanizer(foreign, true));
+				else
+					out += Mv::to(y+1+cy, x+1+cx) + ljust(fmt::format(" H{} M{} F{}",
+						floating_humanizer(hit, true), floating_humanizer(miss, true), floating_humanizer(foreign, true)), disks_width);
+				cy++;
+			}
+			if (cy < height - 2) out += Mv::to(y+1+cy, x+1+cx) + divider;
+		}
+
+		//? Kernel activity
+		else if (show_disks and mem_panel == "kernel") {
+			cx = mem_width; cy = 0;
+			const int kernel_graph_width = disks_width - 13;
+			set_panel_divider();
+			out += Mv::to(y+1+cy, x+1+cx) + divider + Theme::c("title") + Fx::b + "Kernel" + Theme::c("main_fg") + Fx::ub
+				+ Mv::to(y+1+cy, x+cx + disks_width - 2) + Theme::c("graph_text") + "/s";
+			cy++;
+			if (rng::all_of(mem.kernel.values, &deque<long long>::empty))
+				out += Mv::to(y+1+cy, x+1+cx) + Theme::c("inactive_fg") + uresize(" No kernel information", disks_width);
+			for (size_t stat = 0; stat < KERNEL_COUNT; stat++) {
+				if (cy > height - 3) break;
+				const auto& values = mem.kernel.values[stat];
+				if (values.empty()) continue;
+				out += Mv::to(y+1+cy, x+1+cx) + Theme::c("main_fg") + ljust(kernel_labels[stat], 8);
+
+				//? Graphs are scaled to the highest value shown and recreated when that changes a lot
+				if (kernel_graph_width >= 3) {
+					const long long graph_max = max(1ll, rng::max(values));
+					auto& old_max = kernel_graph_max[stat];
+					if (old_max == 0 or graph_max > old_max or graph_max * 4 < old_max) {
+						old_max = graph_max;
+						kernel_graphs[stat] = Draw::Graph{kernel_graph_width, 1, (stat == FILES ? "cached" : "used"), values, graph_symbol, false, false, old_max};
+						out += kernel_graphs[stat]();
+					}
+					else
+						out += kernel_graphs[stat](values, data_same);
+				}
+				out += Theme::c("title") + rjust(count_humanizer(values.back()), 5);
+				cy++;
+			}
+			for (; cy < height - 2; cy++)
+				out += Mv::to(y+1+cy, x+1+cx) + string(disks_width, ' ');
+		}
+
+		//? Swap areas, zram and zswap
+		else if (show_disks and mem_panel == "swap") {
+			const auto& swap = mem.swap;
+			const bool big_swap = disks_width >= 25;
+			cx = mem_width; cy = 0;
+			set_panel_divider();
+			auto ratio_str = [](uint64_t orig, uint64_t compr) {
+				return (compr > 0 ? fmt::format("{:.1f}x", (double)orig / compr) : "-"s);
+			};
+			auto title_line = [&](const string& title, const string& right) {
+				out += Mv::to(y+1+cy, x+1+cx) + divider + Theme::c("title") + Fx::b + uresize(title, disks_width - right.size() - 1)
+					+ Mv::to(y+1+cy, x+cx + disks_width - right.size()) + trans(right) + Fx::ub + Theme::c("main_fg");
+				cy++;
+			};
+			auto compression_line = [&](uint64_t orig, uint64_t compr) {
+				out += Mv::to(y+1+cy, x+1+cx) + ljust((big_swap ? " Data " : " D ") + floating_humanizer(orig, true)
+					+ (big_swap ? " Comp " : " C ") + floating_humanizer(compr, true) + ' ' + ratio_str(orig, compr), disks_width);
+				cy++;
+			};
+
+			//? Two rows are kept for the compression ratio graph at the bottom
+			const bool compressed = swap.zswap_pool > 0 or rng::any_of(swap.devices, [](const auto& dev) { return dev.zram; });
+			const int reserved = (compressed ? 2 : 0);
+			if (swap.devices.empty() and not compressed)
+				out += Mv::to(y+1+cy++, x+1+cx) + Theme::c("inactive_fg") + uresize(" No swap information", disks_width);
+			for (const auto& dev : swap.devices) {
+				if (cy + (dev.zram ? 3 : 2) > height - 2 - reserved) break;
+				title_line(std::filesystem::path(dev.name).filename().string() + (big_swap ? " prio " : " p") + to_string(dev.priority), floating_humanizer(dev.size, not big_swap));
+				out += Mv::to(y+1+cy, x+1+cx) + (big_swap ? " Used:" + rjust(to_string(dev.used_percent) + '%', 4) : "U") + ' '
+					+ swap_meter(dev.used_percent) + rjust(floating_humanizer(dev.used, not big_swap), (big_swap ? 9 : 5));
+				cy++;
+				if (dev.zram) compression_line(dev.orig, dev.compr);
+			}
+			if (swap.zswap_pool > 0 and cy + 2 <= height - 2 - reserved) {
+				title_line("Zswap", floating_humanizer(swap.zswap_pool, not big_swap));
+				compression_line(swap.zswapped, swap.zswap_pool);
+			}
+
+			//? Combined compression ratio, scaled to the highest value shown and recreated when that or the space changes
+			if (compressed and not swap.ratio.empty() and cy <= height - 4) {
+				title_line("Ratio", fmt::format("{:.1f}x", swap.ratio.back() / 100.0));
+				const int graph_height = height - 2 - cy;
+				const long long graph_max = max(200ll, rng::max(swap.ratio));
+				if (redraw or graph_height != swap_graph_height or graph_max > swap_ratio_max or graph_max * 4 < swap_ratio_max) {
+					swap_graph_height = graph_height;
+					swap_ratio_max = graph_max;
+					swap_ratio_graph = Draw::Graph{disks_width, graph_height, "cached", swap.ratio, graph_symbol, false, false, swap_ratio_max};
+					out += Mv::to(y+1+cy, x+1+cx) + swap_ratio_graph();
+				}
+				else
+					out += Mv::to(y+1+cy, x+1+cx) + swap_ratio_graph(swap.ratio, data_same);
+				cy += graph_height;
+			}
+			for (; cy < height - 2; cy++)
+				out += Mv::to(y+1+cy, x+1+cx) + string(disks_width, ' ');
+		}
 
 		//? Disks
-		if (show_disks) {
+		else if (show_disks) {
 			const auto& disks = mem.disks;
 			cx = mem_width; cy = 0;
 			bool big_disk = disks_width >= 25;
-			divider = Mv::l(1) + Theme::c("div_line") + Symbols::div_left + Symbols::h_line * disks_width + Theme::c("mem_box") + Fx::ub + Symbols::div_right + Mv::l(disks_width);
-			const string hu_div = Theme::c("div_line") + Symbols::h_line + Theme::c("main_fg");
+			set_panel_divider();
+			auto hu_div = [&] {
+				out += Theme::c("div_line");
+				out += Symbols::h_line;
+				out += Theme::c("main_fg");
+			};
+
+			//? Disks whose size query has stopped answering are dimmed and marked stale
+			auto disk_title = [&](const disk_info& disk) {
+				if (disk.stale) {
+					out += Theme::c("inactive_fg");
+					out += Fx::b;
+					out += uresize(disk.name, max(1, disks_width - 15));
+					out += Fx::ub;
+					out += " stale";
+					out += Fx::b;
+					return;
+				}
+				out += Theme::c("title");
+				out += Fx::b;
+				out += uresize(disk.name, disks_width - 8);
+			};
+
+			//? Small io graph with label, values other than activity % are scaled to the highest value shown and printed at the end
+			auto io_stat_line = [&](const string& mount, const disk_info& disk) {
+				static const std::unordered_map<string, string> labels = {
+					{"activity", "IO%"}, {"iops", "IOPS"}, {"await", "Lat"}, {"queue", "Que"}, {"discard", "Dsc"}
+				};
+				const auto& values = io_stat_values(disk, io_stat);
+				const auto& label = labels.at(io_stat);
+				out += ' ';
+				if (big_disk)
+					ljust_to(out, label, 4);
+				else {
+					out.append(label, 0, 2);
+					out += "   ";
+					Mv::l(out, 2);
+				}
+				out += Theme::c("inactive_fg");
+				for (int i = 0; i < io_stat_width; i++) out += graph_bg;
+				if (not io_stat_scaled) out += Theme::g("available").at(clamp(values.back(), 50ll, 100ll));
+				Mv::l(out, io_stat_width);
+				const long long graph_max = (io_stat_scaled ? max(1ll, rng::max(values)) : 0);
+				if (io_stat_scaled and (graph_max > io_graph_max[mount] or graph_max * 4 < io_graph_max[mount])) {
+					io_graph_max[mount] = graph_max;
+					io_graphs[mount + "_activity"] = Draw::Graph{io_stat_width, 1, "available", values, graph_symbol, false, false, graph_max};
+					out += io_graphs.at(mount + "_activity")();
+				}
+				else
+					out += io_graphs.at(mount + "_activity")(values, redraw or data_same);
+				if (io_stat_scaled) {
+					const long long val = values.back();
+					string human;
+					if (io_stat == "await")
+						human = (val < 10000 ? fmt::format("{:.1f}ms", val / 1000.0) : (val < 1000000 ? to_string(val / 1000) + "ms" : to_string(val / 1000000) + 's'));
+					else if (io_stat == "queue")
+						human = fmt::format("{:.2f}", val / 100.0);
+					else if (io_stat == "discard")
+						human = floating_humanizer(val, true);
+					else
+						human = count_humanizer(val);
+					out += Theme::c("title");
+					rjust_to(out, human, 6);
+				}
+				out += Theme::c("main_fg");
+			};
 			if (io_mode) {
 				for (const auto& mount : mem.disks_order) {
 					if (not disks.contains(mount)) continue;
@@ -1279,15 +2131,23 @@ namespace Mem {
 					const auto& disk = safeVal(disks, mount);
 					if (disk.io_read.empty()) continue;
 					const string total = floating_humanizer(disk.total, not big_disk);
-					out += Mv::to(y+1+cy, x+1+cx) + divider + Theme::c("title") + Fx::b + uresize(disk.name, disks_width - 8) + Mv::to(y+1+cy, x+cx + disks_width - total.size())
-						+ trans(total) + Fx::ub;
+					Mv::to(out, y+1+cy, x+1+cx);
+					out += divider;
+					disk_title(disk);
+					Mv::to(out, y+1+cy, x+cx + disks_width - total.size());
+					out += trans(total);
+					out += Fx::ub;
 					if (big_disk) {
 						const string used_percent = to_string(disk.used_percent);
-						out += Mv::to(y+1+cy, x+1+cx + round((double)disks_width / 2) - round((double)used_percent.size() / 2) - 1) + hu_div + used_percent + '%' + hu_div;
+						Mv::to(out, y+1+cy, x+1+cx + round((double)disks_width / 2) - round((double)used_percent.size() / 2) - 1);
+						hu_div();
+						out += used_percent;
+						out += '%';
+						hu_div();
 					}
 					if (io_graphs.contains(mount + "_activity")) {
-					out += Mv::to(y+2+cy++, x+1+cx) + (big_disk ? " IO% " : " IO   " + Mv::l(2)) + Theme::c("inactive_fg") + graph_bg * (disks_width - 6)
-						+ Mv::l(disks_width - 6) + io_graphs.at(mount + "_activity")(disk.io_activity, redraw or data_same) + Theme::c("main_fg");
+						Mv::to(out, y+2+cy++, x+1+cx);
+						io_stat_line(mount, disk);
 					}
 					if (++cy > height - 3) break;
 					if (not io_graphs.contains(mount)) continue;
@@ -1324,25 +2184,54 @@ namespace Mem {
 					const string human_used = floating_humanizer(disk.used, not big_disk);
 					const string human_free = floating_humanizer(disk.free, not big_disk);
 
-					out += Mv::to(y+1+cy, x+1+cx) + divider + Theme::c("title") + Fx::b + uresize(disk.name, disks_width - 8) + Mv::to(y+1+cy, x+cx + disks_width - human_total.size())
-						+ trans(human_total) + Fx::ub + Theme::c("main_fg");
-					if (big_disk and not human_io.empty())
-						out += Mv::to(y+1+cy, x+1+cx + round((double)disks_width / 2) - round((double)human_io.size() / 2) - 1) + hu_div + human_io + hu_div;
+					Mv::to(out, y+1+cy, x+1+cx);
+					out += divider;
+					disk_title(disk);
+					Mv::to(out, y+1+cy, x+cx + disks_width - human_total.size());
+					out += trans(human_total);
+					out += Fx::ub;
+					out += Theme::c("main_fg");
+					if (big_disk and not human_io.empty()) {
+						Mv::to(out, y+1+cy, x+1+cx + round((double)disks_width / 2) - round((double)human_io.size() / 2) - 1);
+						hu_div();
+						out += human_io;
+						hu_div();
+					}
 					if (++cy > height - 3) break;
 					if (show_io_stat and io_graphs.contains(mount + "_activity")) {
-						out += Mv::to(y+1+cy, x+1+cx) + (big_disk ? " IO% " : " IO   " + Mv::l(2)) + Theme::c("inactive_fg") + graph_bg * (disks_width - 6) + Theme::g("available").at(clamp(disk.io_activity.back(), 50ll, 100ll))
-							+ Mv::l(disks_width - 6) + io_graphs.at(mount + "_activity")(disk.io_activity, redraw or data_same) + Theme::c("main_fg");
-						if (not big_disk) out += Mv::to(y+1+cy, x+cx+1) + Theme::c("main_fg") + human_io;
+						Mv::to(out, y+1+cy, x+1+cx);
+						io_stat_line(mount, disk);
+						if (not big_disk) {
+							Mv::to(out, y+1+cy, x+cx+1);
+							out += Theme::c("main_fg");
+							out += human_io;
+						}
 						if (++cy > height - 3) break;
 					}
 
-					out += Mv::to(y+1+cy, x+1+cx) + (big_disk ? " Used:" + rjust(to_string(disk.used_percent) + '%', 4) : "U") + ' '
-						+ disk_meters_used.at(mount)(disk.used_percent) + rjust(human_used, (big_disk ? 9 : 5));
+					Mv::to(out, y+1+cy, x+1+cx);
+					if (big_disk) {
+						out += " Used:";
+						rjust_to(out, to_string(disk.used_percent) + '%', 4);
+					}
+					else
+						out += 'U';
+					out += ' ';
+					out += disk_meters_used.at(mount)(disk.used_percent);
+					rjust_to(out, human_used, (big_disk ? 9 : 5));
 					if (++cy > height - 3) break;
 
 					if (disk_meters_free.contains(mount) and cmp_less_equal(disks.size() * 3 + (show_io_stat ? disk_ios : 0), height - 1)) {
-						out += Mv::to(y+1+cy, x+1+cx) + (big_disk ? " Free:" + rjust(to_string(disk.free_percent) + '%', 4) : "F") + ' '
-						+ disk_meters_free.at(mount)(disk.free_percent) + rjust(human_free, (big_disk ? 9 : 5));
+						Mv::to(out, y+1+cy, x+1+cx);
+						if (big_disk) {
+							out += " Free:";
+							rjust_to(out, to_string(disk.free_percent) + '%', 4);
+						}
+						else
+							out += 'F';
+						out += ' ';
+						out += disk_meters_free.at(mount)(disk.free_percent);
+						rjust_to(out, human_free, (big_disk ? 9 : 5));
 						cy++;
 						if (cmp_less_equal(disks.size() * 4 + (show_io_stat ? disk_ios : 0), height - 1)) cy++;
 					}
@@ -1353,7 +2242,7 @@ namespace Mem {
 		}
 
 		redraw = false;
-		return out + Fx::reset;
+		out += Fx::reset;
 	}
 
 }
@@ -1362,15 +2251,17 @@ namespace Net {
 	int width_p = 45, height_p = 32;
 	int min_width = 36, min_height = 6;
 	int x = 1, y, width = 20, height;
-	int b_x, b_y, b_width, b_height, d_graph_height, u_graph_height;
+	int b_x, b_y, b_width, b_height, p_y, p_height, t_y, t_height, s_x, s_width, graph_width, d_graph_height, u_graph_height;
 	bool shown = true, redraw = true;
 	const int MAX_IFNAMSIZ = 15;
 	string old_ip;
 	std::unordered_map<string, Draw::Graph> graphs;
+	Draw::Graph packet_graph;
+	long long packet_graph_max{};
 	string box;
 
-	string draw(const net_info& net, bool force_redraw, bool data_same) {
-		if (Runner::stopping) return "";
+	void draw(string& out, const net_info& net, bool force_redraw, bool data_same) {
+		if (Runner::stopping) return;
 		if (force_redraw) redraw = true;
 		auto net_sync = Config::getB("net_sync");
 		auto net_auto = Config::getB("net_auto");
@@ -1381,27 +2272,30 @@ namespace Net {
 			old_ip = ip_addr;
 			redraw = true;
 		}
-		string out;
-		out.reserve(width * height);
-		const string title_left = Theme::c("net_box") + Fx::ub + Symbols::title_left;
-		const string title_right = Theme::c("net_box") + Fx::ub + Symbols::title_right;
+		static string title_left, title_right;
+		if (redraw) {
+			title_left = Theme::c("net_box") + Fx::ub + Symbols::title_left;
+			title_right = Theme::c("net_box") + Fx::ub + Symbols::title_right;
+		}
 		const int i_size = min((int)selected_iface.size(), MAX_IFNAMSIZ);
 		const long long down_max = (net_auto ? safeVal(graph_max, "download"s) : ((long long)(Config::getI("net_download")) << 20) / 8);
 		const long long up_max = (net_auto ? safeVal(graph_max, "upload"s) : ((long long)(Config::getI("net_upload")) << 20) / 8);
 
 		//* Redraw elements not needed to be updated every cycle
 		if (redraw) {
-			out = box;
+			out += box;
 			//? Graphs
 			graphs.clear();
-			if (safeVal(net.bandwidth, "download"s).empty() or safeVal(net.bandwidth, "upload"s).empty())
-				return out + Fx::reset;
+			if (safeVal(net.bandwidth, "download"s).empty() or safeVal(net.bandwidth, "upload"s).empty()) {
+				out += Fx::reset;
+				return;
+			}
 			graphs["download"] = Draw::Graph{
-				width - b_width - 2, u_graph_height, "download",
+				graph_width, u_graph_height, "download",
 				net.bandwidth.at("download"), graph_symbol,
 				false, true, down_max};
 			graphs["upload"] = Draw::Graph{
-				width - b_width - 2, d_graph_height, "upload",
+				graph_width, d_graph_height, "upload",
 				net.bandwidth.at("upload"), graph_symbol, true, true, up_max};
 
 			//? Interface selector and buttons
@@ -1426,34 +2320,137 @@ namespace Net {
 
 		//? IP or device address
 		if (not ip_addr.empty() and cmp_greater(width - i_size - 36, ip_addr.size())) {
-			out += Mv::to(y, x + 8) + title_left + Theme::c("title") + Fx::b + ip_addr + title_right;
+			Mv::to(out, y, x + 8);
+			out += title_left;
+			out += Theme::c("title");
+			out += Fx::b;
+			out += ip_addr;
+			out += title_right;
 		}
 
 		//? Graphs and stats
 		int cy = 0;
 		for (const string dir : {"download", "upload"}) {
-			out += Mv::to(y+1 + (dir == "upload" ? u_graph_height : 0), x + 1) + graphs.at(dir)(safeVal(net.bandwidth, dir), redraw or data_same or not net.connected)
-				+ Mv::to(y+1 + (dir == "upload" ? height - 3: 0), x + 1) + Fx::ub + Theme::c("graph_text")
-				+ floating_humanizer((dir == "upload" ? up_max : down_max), true);
+			Mv::to(out, y+1 + (dir == "upload" ? u_graph_height : 0), x + 1);
+			out += graphs.at(dir)(safeVal(net.bandwidth, dir), redraw or data_same or not net.connected);
+			Mv::to(out, y+1 + (dir == "upload" ? height - 3: 0), x + 1);
+			out += Fx::ub;
+			out += Theme::c("graph_text");
+			out += floating_humanizer((dir == "upload" ? up_max : down_max), true);
 			const string speed = floating_humanizer(safeVal(net.stat, dir).speed, false, 0, false, true);
 			const string speed_bits = (b_width >= 20 ? floating_humanizer(safeVal(net.stat, dir).speed, false, 0, true, true) : "");
 			const string top = floating_humanizer(safeVal(net.stat, dir).top, false, 0, true, true);
 			const string total = floating_humanizer(safeVal(net.stat, dir).total);
-			const string symbol = (dir == "upload" ? "▲" : "▼");
-			out += Mv::to(b_y+1+cy, b_x+1) + Fx::ub + Theme::c("main_fg") + symbol + ' ' + ljust(speed, 10) + (b_width >= 20 ? rjust('(' + speed_bits + ')', 13) : "");
+			const std::string_view symbol = (dir == "upload" ? "▲" : "▼");
+			Mv::to(out, b_y+1+cy, b_x+1);
+			out += Fx::ub;
+			out += Theme::c("main_fg");
+			out += symbol;
+			out += ' ';
+			ljust_to(out, speed, 10);
+			if (b_width >= 20) rjust_to(out, '(' + speed_bits + ')', 13);
 			cy += (b_height == 5 ? 2 : 1);
 			if (b_height >= 8) {
-				out += Mv::to(b_y+1+cy, b_x+1) + symbol + ' ' + "Top: " + rjust('(' + top, (b_width >= 20 ? 17 : 9)) + ')';
+				Mv::to(out, b_y+1+cy, b_x+1);
+				out += symbol;
+				out += " Top: ";
+				rjust_to(out, '(' + top, (b_width >= 20 ? 17 : 9));
+				out += ')';
 				cy++;
 			}
 			if (b_height >= 6) {
-				out += Mv::to(b_y+1+cy, b_x+1) + symbol + ' ' + "Total: " + rjust(total, (b_width >= 20 ? 16 : 8));
+				Mv::to(out, b_y+1+cy, b_x+1);
+				out += symbol;
+				out += " Total: ";
+				rjust_to(out, total, (b_width >= 20 ? 16 : 8));
 				cy += (b_height > 6 and b_height % 2 ? 2 : 1);
 			}
 		}
 
+		//? Packets per second and average packet size per direction, drop and error rates
+		if (p_height > 0) {
+			const int inner = b_width - 2;
+			const bool big = b_width >= 20;
+			const auto& rates = net.rates;
+			for (const string dir : {"download", "upload"}) {
+				const bool down = dir == "download";
+				const uint64_t pps = rates[down ? RX_PACKETS : TX_PACKETS];
+				const string avg = (big ? "avg " + (pps > 0 ? floating_humanizer(safeVal(net.stat, dir).speed / pps, true) : "-"s) : "");
+				Mv::to(out, p_y+1 + (down ? 0 : 1), b_x+1);
+				out += Theme::c("main_fg");
+				out += (down ? "▼ " : "▲ ");
+				rjust_to(out, count_humanizer(pps), 5);
+				out += " pkt/s";
+				rjust_to(out, avg, inner - 13);
+			}
+			const size_t count_width = (big ? 5 : 4);
+			auto error_line = [&](const std::string_view a, uint64_t a_rate, const std::string_view b, uint64_t b_rate) {
+				out += (a_rate > 0 ? Theme::c("hi_fg") : Theme::c("main_fg"));
+				out += a;
+				out += ' ';
+				ljust_to(out, count_humanizer(a_rate), count_width);
+				out += (b_rate > 0 ? Theme::c("hi_fg") : Theme::c("main_fg"));
+				out += ' ';
+				out += b;
+				out += ' ';
+				ljust_to(out, count_humanizer(b_rate), inner - a.size() - b.size() - 3 - count_width);
+			};
+			Mv::to(out, p_y+3, b_x+1);
+			error_line((big ? "Drop " : "Drp"), rates[RX_DROPPED], (big ? "Miss" : "Mis"), rates[RX_MISSED]);
+			Mv::to(out, p_y+4, b_x+1);
+			error_line((big ? "TxErr" : "Err"), rates[TX_ERRORS], (big ? "Fifo" : "Ffo"), rates[FIFO_ERRORS]);
+
+			//? Received + transmitted packets per second, rescaled when the highest value shown changes a lot
+			if (p_height > 6 and not net.packets.empty()) {
+				const long long graph_max = max(10ll, rng::max(net.packets));
+				if (redraw or graph_max > packet_graph_max or graph_max * 4 < packet_graph_max) {
+					packet_graph_max = graph_max;
+					packet_graph = Draw::Graph{inner, p_height - 6, "download", net.packets, graph_symbol, false, true, packet_graph_max};
+					out += Mv::to(p_y+5, b_x+1) + packet_graph();
+				}
+				else
+					out += Mv::to(p_y+5, b_x+1) + packet_graph(net.packets, data_same);
+			}
+		}
+
+		//? TCP and UDP health, lines are dropped from the bottom if the box is short
+		if (s_width > 0) {
+			static const array<std::pair<Proto, string>, PROTO_COUNT> proto_lines {{
+				{TCP_ESTABLISHED, "Estab"}, {TCP_ACTIVE_OPENS, "Act open"}, {TCP_PASSIVE_OPENS, "Pas open"}, {TCP_RETRANS, "Retrans"},
+				{TCP_LISTEN_OVERFLOWS, "Lst ovfl"}, {TCP_LISTEN_DROPS, "Lst drop"}, {UDP_RCVBUF_ERRORS, "UDP rcvbuf"}
+			}};
+			for (int i = 0; i < b_height - 2 and i < (int)proto_lines.size(); i++) {
+				const auto& [stat, label] = proto_lines[i];
+				const uint64_t value = proto_stats[stat];
+				const bool problem = value > 0 and is_in(stat, TCP_RETRANS, TCP_LISTEN_OVERFLOWS, TCP_LISTEN_DROPS, UDP_RCVBUF_ERRORS);
+				Mv::to(out, b_y+1+i, s_x+1);
+				out += Theme::c("main_fg");
+				ljust_to(out, label, 10);
+				out += (problem ? Theme::c("hi_fg") : Theme::c("main_fg"));
+				rjust_to(out, count_humanizer(value) + (stat == TCP_ESTABLISHED ? "" : "/s"), s_width - 12);
+			}
+		}
+
+		//? Busiest interfaces by current download + upload rate
+		if (t_height > 0) {
+			for (int i = 0; i < t_height - 2; i++) {
+				Mv::to(out, t_y+1+i, b_x+1);
+				if (i >= (int)top_talkers.size() or not current_net.contains(top_talkers[i])) {
+					out.append(b_width - 2, ' ');
+					continue;
+				}
+				const auto& iface = top_talkers[i];
+				const auto& stat = current_net.at(iface).stat;
+				const string rate = floating_humanizer(stat.at("download").speed + stat.at("upload").speed, false, 0, false, true);
+				out += (iface == selected_iface ? Theme::c("hi_fg") : Theme::c("main_fg"));
+				ljust_to(out, iface, b_width - 13);
+				out += Theme::c("main_fg");
+				rjust_to(out, rate, 11);
+			}
+		}
+
 		redraw = false;
-		return out + Fx::reset;
+		out += Fx::reset;
 	}
 
 }
@@ -1469,11 +2466,18 @@ namespace Proc {
 	std::unordered_map<size_t, Draw::Graph> p_graphs;
 	std::unordered_map<size_t, bool> p_wide_cmd;
 	std::unordered_map<size_t, int> p_counters;
+
+	//* Process line drawn last update and hash of the values shown on it
+	struct proc_line {
+		uint64_t hash{};
+		string line;
+	};
+	std::unordered_map<size_t, proc_line> p_lines;
 	int counter = 0;
 	Draw::TextEdit filter;
 	Draw::Graph detailed_cpu_graph;
 	Draw::Graph detailed_mem_graph;
-	int user_size, thread_size, prog_size, cmd_size, tree_size;
+	int user_size, thread_size, prog_size, cmd_size, tree_size, numa_size, fd_size;
 	int dgraph_x, dgraph_width, d_width, d_x, d_y;
 
 	string box;
@@ -1538,8 +2542,8 @@ namespace Proc {
 		return (not changed ? -1 : selected);
 	}
 
-	string draw(const vector<proc_info>& plist, bool force_redraw, bool data_same) {
-		if (Runner::stopping) return "";
+	void draw(string& out, const vector<proc_info>& plist, bool force_redraw, bool data_same) {
+		if (Runner::stopping) return;
 		auto proc_tree = Config::getB("proc_tree");
 		bool show_detailed = (Config::getB("show_detailed") and cmp_equal(Proc::detailed.last_pid, Config::getI("detailed_pid")));
 		bool proc_gradient = (Config::getB("proc_gradient") and not Config::getB("lowcolor") and Theme::gradients.contains("proc"));
@@ -1558,12 +2562,11 @@ namespace Proc {
 		auto totalMem = Mem::get_totalMem();
 		int numpids = Proc::numpids;
 		if (force_redraw) redraw = true;
-		string out;
-		out.reserve(width * height);
 
 		//* Redraw elements not needed to be updated every cycle
 		if (redraw) {
-			out = box;
+			out += box;
+			p_lines.clear();
 			const string title_left = Theme::c("proc_box") + Symbols::title_left;
 			const string title_right = Theme::c("proc_box") + Symbols::title_right;
 			const string title_left_down = Theme::c("proc_box") + Symbols::title_left_down;
@@ -1581,6 +2584,16 @@ namespace Proc {
 				cmd_size += 5;
 				tree_size += 5;
 			}
+			numa_size = (Config::getB("proc_numa") and width > 75 ? 5 : 0);
+			if (numa_size > 0) {
+				cmd_size -= numa_size + 1;
+				tree_size -= numa_size + 1;
+			}
+			fd_size = (Config::getB("proc_fds") and width > 75 ? 5 : 0);
+			if (fd_size > 0) {
+				cmd_size -= (fd_size + 1) * 2;
+				tree_size -= (fd_size + 1) * 2;
+			}
 
 			//? Detailed box
 			if (show_detailed) {
@@ -1630,7 +2643,7 @@ namespace Proc {
 
 				//? Labels
 				const int item_fit = floor((double)(d_width - 2) / 10);
-				const int item_width = floor((double)(d_width - 2) / min(item_fit, 8));
+				const int item_width = floor((double)(d_width - 2) / min(item_fit, (fd_size > 0 ? 9 : 8)));
 				out += Mv::to(d_y + 1, d_x + 1) + Fx::b + Theme::c("title")
 										+ cjust("Status:", item_width)
 										+ cjust("Elapsed:", item_width);
@@ -1640,6 +2653,7 @@ namespace Proc {
 				if (item_fit >= 6) out += cjust("User:", item_width);
 				if (item_fit >= 7) out += cjust("Threads:", item_width);
 				if (item_fit >= 8) out += cjust("Nice:", item_width);
+				if (item_fit >= 9 and fd_size > 0) out += cjust("FDs:", item_width);
 
 
 				//? Command line
@@ -1729,6 +2743,8 @@ namespace Proc {
 					+ ljust("Tree:", tree_size) + ' ';
 
 			out += (thread_size > 0 ? Mv::l(4) + "Threads: " : "")
+					+ (numa_size > 0 ? rjust("Node:", numa_size) + ' ' : "")
+					+ (fd_size > 0 ? rjust("FDs:", fd_size) + ' ' + rjust("Sock:", fd_size) + ' ' : "")
 					+ ljust("User:", user_size) + ' '
 					+ rjust((mem_bytes ? "MemB" : "Mem%"), 5) + ' '
 					+ rjust("Cpu%", (show_graphs ? 10 : 5)) + Fx::ub;
@@ -1739,7 +2755,7 @@ namespace Proc {
 		if (show_detailed) {
 			bool alive = detailed.status != "Dead";
 			const int item_fit = floor((double)(d_width - 2) / 10);
-			const int item_width = floor((double)(d_width - 2) / min(item_fit, 8));
+			const int item_width = floor((double)(d_width - 2) / min(item_fit, (fd_size > 0 ? 9 : 8)));
 
 			//? Graph part of box
 			string cpu_str = (alive ? to_string(detailed.entry.cpu_p) : "");
@@ -1763,6 +2779,7 @@ namespace Proc {
 			if (item_fit >= 6) out += cjust(detailed.entry.user, item_width, true);
 			if (item_fit >= 7) out += cjust(to_string(detailed.entry.threads), item_width);
 			if (item_fit >= 8) out += cjust(to_string(detailed.entry.p_nice), item_width);
+			if (item_fit >= 9 and fd_size > 0) out += cjust(detailed.fds, item_width);
 
 
 			const double mem_p = (double)detailed.mem_bytes.back() * 100 / totalMem;
@@ -1784,6 +2801,40 @@ namespace Proc {
 		if (selected > numpids)
 			selected = numpids;
 
+		//? Counts not refreshed for a few updates are dimmed, they are refreshed a few processes at a time
+		const uint64_t fd_stale_ms = max(5000, Config::getI("update_ms") * 3);
+		const uint64_t now = time_ms();
+		auto fd_columns = [&](const proc_info& p, bool stale) {
+			if (stale) out += Theme::c("inactive_fg");
+			rjust_to(out, (p.fds >= 0 ? count_humanizer(p.fds) : "-"s), fd_size);
+			out += ' ';
+			rjust_to(out, (p.sockets >= 0 ? count_humanizer(p.sockets) : "-"s), fd_size);
+			out += ' ';
+			if (stale) out += Theme::c("main_fg");
+		};
+
+		//? Hash of everything that decides how a process line looks, lines with the same hash as last update are reused
+		auto line_hash = [](const auto&... values) {
+			uint64_t hash = fnv1a("");
+			auto add = [&hash](const auto& value) {
+				auto add_bytes = [&hash](const auto& v) { hash = fnv1a({reinterpret_cast<const char*>(&v), sizeof(v)}, hash); };
+				//? Length goes in before the bytes so "ab" + "c" and "a" + "bc" hash differently
+				if constexpr (std::is_convertible_v<decltype(value), std::string_view>) {
+					const std::string_view str = value;
+					add_bytes(str.size());
+					hash = fnv1a(str, hash);
+				}
+				else add_bytes(value);
+			};
+			(add(values), ...);
+			return hash;
+		};
+
+		//? Reused for every line, so building a line only appends to out
+		string end;
+		const string graph_bg_line = (show_graphs ? graph_bg * 5 : "");
+		deque<long long> graph_value(1);
+
 		//* Iteration over processes
 		int lc = 0;
 		for (int n=0; auto& p : plist) {
@@ -1810,20 +2861,18 @@ namespace Proc {
 					p_counters[p.pid] = 0;
 			}
 
-			out += Fx::reset;
-
 			//? Set correct gradient colors if enabled
-			string c_color, m_color, t_color, g_color, end;
+			std::string_view c_color, m_color, t_color, g_color;
 			if (is_selected) {
 				c_color = m_color = t_color = g_color = Fx::b;
 				end = Fx::ub;
-				out += Theme::c("selected_bg") + Theme::c("selected_fg") + Fx::b;
 			}
 			else {
 				int calc = (selected > lc) ? selected - lc : lc - selected;
 				if (proc_colors) {
-					end = Theme::c("main_fg") + Fx::ub;
-					array<string, 3> colors;
+					end = Theme::c("main_fg");
+					end += Fx::ub;
+					array<std::string_view, 3> colors;
 					for (int i = 0; int v : {(int)round(p.cpu_p), (int)round(p.mem * 100 / totalMem), (int)p.threads / 3}) {
 						if (proc_gradient) {
 							int val = (min(v, 100) + 100) - calc * 100 / select_max;
@@ -1844,33 +2893,79 @@ namespace Proc {
 				}
 			}
 
-			if (not p_wide_cmd.contains(p.pid)) p_wide_cmd[p.pid] = ulen(p.cmd) != ulen(p.cmd, true);
+			if (not p_wide_cmd.contains(p.pid)) {
+				const auto fit = ufit(p.cmd, 0, true);
+				p_wide_cmd[p.pid] = fit.width != fit.chars;
+			}
+
+			//? Lines with a cpu graph change every update and are always drawn
+			const bool fd_stale = p.fds >= 0 and now - p.fd_time > fd_stale_ms;
+			const bool live_graph = p_graphs.contains(p.pid);
+			auto& cached = p_lines[p.pid];
+			if (not live_graph) {
+				const uint64_t hash = line_hash(y + lc, is_selected, c_color, m_color, t_color, g_color, end,
+					p.cpu_p, p.mem, totalMem, p.threads, p.numa_node, p.fds, p.sockets, fd_stale, p.name, p.cmd, p.short_cmd, p.user, p.prefix);
+				if (hash == cached.hash and not cached.line.empty()) {
+					out += cached.line;
+					if (lc++ > height - 5) break;
+					continue;
+				}
+				cached.hash = hash;
+			}
+			const size_t line_start = out.size();
+
+			out += Fx::reset;
+			if (is_selected) {
+				out += Theme::c("selected_bg");
+				out += Theme::c("selected_fg");
+				out += Fx::b;
+			}
 
 			//? Normal view line
 			if (not proc_tree) {
-				out += Mv::to(y+2+lc, x+1)
-					+ g_color + rjust(to_string(p.pid), 8) + ' '
-					+ c_color + ljust(p.name, prog_size, true) + ' ' + end
-					+ (cmd_size > 0 ? g_color + ljust(p.cmd, cmd_size, true, p_wide_cmd[p.pid]) + Mv::to(y+2+lc, x+11+prog_size+cmd_size) + ' ' : "");
+				Mv::to(out, y+2+lc, x+1);
+				out += g_color;
+				rjust_to(out, to_string(p.pid), 8);
+				out += ' ';
+				out += c_color;
+				ljust_to(out, p.name, prog_size, true);
+				out += ' ';
+				out += end;
+				if (cmd_size > 0) {
+					out += g_color;
+					ljust_to(out, p.cmd, cmd_size, true, p_wide_cmd[p.pid]);
+					Mv::to(out, y+2+lc, x+11+prog_size+cmd_size);
+					out += ' ';
+				}
 			}
 			//? Tree view line
 			else {
 				const string prefix_pid = p.prefix + to_string(p.pid);
 				int width_left = tree_size;
-				out += Mv::to(y+2+lc, x+1) + g_color + uresize(prefix_pid, width_left) + ' ';
+				Mv::to(out, y+2+lc, x+1);
+				out += g_color;
+				out += uresize(prefix_pid, width_left);
+				out += ' ';
 				width_left -= ulen(prefix_pid);
 				if (width_left > 0) {
-					out += c_color + uresize(p.name, width_left - 1) + end + ' ';
+					out += c_color;
+					out += uresize(p.name, width_left - 1);
+					out += end;
+					out += ' ';
 					width_left -= (ulen(p.name) + 1);
 				}
 				if (width_left > 7) {
 					const string& cmd = width_left > 40 ? rtrim(p.cmd) : p.short_cmd;
 					if (not cmd.empty() and cmd != p.name) {
-						out += g_color + '(' + uresize(cmd, width_left - 3, p_wide_cmd[p.pid]) + ") ";
+						out += g_color;
+						out += '(';
+						out += uresize(cmd, width_left - 3, p_wide_cmd[p.pid]);
+						out += ") ";
 						width_left -= (ulen(cmd, true) + 3);
 					}
 				}
-				out += string(max(0, width_left), ' ') + Mv::to(y+2+lc, x+2+tree_size);
+				out.append(max(0, width_left), ' ');
+				Mv::to(out, y+2+lc, x+2+tree_size);
 			}
 			//? Common end of line
 			string cpu_str = to_string(p.cpu_p);
@@ -1899,34 +2994,84 @@ namespace Proc {
 				}
 			}();
 
-			out += (thread_size > 0 ? t_color + rjust(proc_threads_string, thread_size) + ' ' + end : "" )
-				+ g_color + ljust((cmp_greater(p.user.size(), user_size) ? p.user.substr(0, user_size - 1) + '+' : p.user), user_size) + ' '
-				+ m_color + rjust(mem_str, 5) + end + ' '
-				+ (is_selected ? "" : Theme::c("inactive_fg")) + (show_graphs ? graph_bg * 5: "")
-				+ (p_graphs.contains(p.pid) ? Mv::l(5) + c_color + p_graphs.at(p.pid)({(p.cpu_p >= 0.1 and p.cpu_p < 5 ? 5ll : (long long)round(p.cpu_p))}, data_same) : "") + end + ' '
-				+ c_color + rjust(cpu_str, 4) + "  " + end;
+			if (thread_size > 0) {
+				out += t_color;
+				rjust_to(out, proc_threads_string, thread_size);
+				out += ' ';
+				out += end;
+			}
+			if (numa_size > 0) {
+				out += g_color;
+				rjust_to(out, (p.numa_node >= 0 ? to_string(p.numa_node) : "-"s), numa_size);
+				out += ' ';
+			}
+			if (fd_size > 0) fd_columns(p, fd_stale);
+			out += g_color;
+			if (cmp_greater(p.user.size(), user_size)) {
+				out.append(p.user, 0, user_size - 1);
+				out += '+';
+			}
+			else
+				ljust_to(out, p.user, user_size);
+			out += ' ';
+			out += m_color;
+			rjust_to(out, mem_str, 5);
+			out += end;
+			out += ' ';
+			if (not is_selected) out += Theme::c("inactive_fg");
+			out += graph_bg_line;
+			if (live_graph) {
+				Mv::l(out, 5);
+				out += c_color;
+				graph_value.front() = (p.cpu_p >= 0.1 and p.cpu_p < 5 ? 5ll : (long long)round(p.cpu_p));
+				out += p_graphs.at(p.pid)(graph_value, data_same);
+			}
+			out += end;
+			out += ' ';
+			out += c_color;
+			rjust_to(out, cpu_str, 4);
+			out += "  ";
+			out += end;
+			if (live_graph) cached.line.clear();
+			else cached.line.assign(out, line_start);
 			if (lc++ > height - 5) break;
 		}
 
 		out += Fx::reset;
-		while (lc++ < height - 5) out += Mv::to(y+lc+1, x+1) + string(width - 2, ' ');
+		while (lc++ < height - 5) {
+			Mv::to(out, y+lc+1, x+1);
+			out.append(width - 2, ' ');
+		}
 
 		//? Draw scrollbar if needed
 		if (numpids > select_max) {
 			const int scroll_pos = clamp((int)round((double)start * select_max / (numpids - select_max)), 0, height - 5);
-			out += Mv::to(y + 1, x + width - 2) + Fx::b + Theme::c("main_fg") + Symbols::up
-				+ Mv::to(y + height - 2, x + width - 2) + Symbols::down;
+			Mv::to(out, y + 1, x + width - 2);
+			out += Fx::b;
+			out += Theme::c("main_fg");
+			out += Symbols::up;
+			Mv::to(out, y + height - 2, x + width - 2);
+			out += Symbols::down;
 
 			for (int i = y + 2; i < y + height - 2; i++) {
-				out += Mv::to(i, x + width - 2) + ((i == y + 2 + scroll_pos) ? "█" : " ");
+				Mv::to(out, i, x + width - 2);
+				out += ((i == y + 2 + scroll_pos) ? "█" : " ");
 			}
 		}
 
 		//? Current selection and number of processes
-		string location = to_string(start + selected) + '/' + to_string(numpids);
-		string loc_clear = Symbols::h_line * max((size_t)0, 9 - location.size());
-		out += Mv::to(y + height - 1, x+width - 3 - max(9, (int)location.size())) + Fx::ub + Theme::c("proc_box") + loc_clear
-			+ Symbols::title_left_down + Theme::c("title") + Fx::b + location + Fx::ub + Theme::c("proc_box") + Symbols::title_right_down;
+		const string location = fmt::format("{}/{}", start + selected, numpids);
+		Mv::to(out, y + height - 1, x+width - 3 - max(9, (int)location.size()));
+		out += Fx::ub;
+		out += Theme::c("proc_box");
+		for (size_t i = location.size(); i < 9; i++) out += Symbols::h_line;
+		out += Symbols::title_left_down;
+		out += Theme::c("title");
+		out += Fx::b;
+		out += location;
+		out += Fx::ub;
+		out += Theme::c("proc_box");
+		out += Symbols::title_right_down;
 
 		//? Clear out left over graphs from dead processes at a regular interval
 		if (not data_same and ++counter >= 100) {
@@ -1943,6 +3088,10 @@ namespace Proc {
 			std::erase_if(p_wide_cmd, [&](const auto& pair) {
 				return rng::find(plist, pair.first, &proc_info::pid) == plist.end();
 			});
+
+			std::erase_if(p_lines, [&](const auto& pair) {
+				return rng::find(plist, pair.first, &proc_info::pid) == plist.end();
+			});
 		}
 
 		if (selected == 0 and selected_pid != 0) {
@@ -1950,7 +3099,7 @@ namespace Proc {
 			selected_name.clear();
 		}
 		redraw = false;
-		return out + Fx::reset;
+		out += Fx::reset;
 	}
 
 }
@@ -2063,6 +3212,36 @@ namespace Draw {
 			b_height = min(height - 2, (int)ceil((double)Shared::coreCount / b_columns) + 4);
 		#endif
 
+			//? Compact core grid, widen the box until all core groups fit in the available height
+			const auto& core_layout = Config::getS("cpu_core_layout");
+			core_grid = core_layout == "grid" or (core_layout == "Auto" and Shared::coreCount > 128);
+			if (core_grid) {
+			#ifdef GPU_SUPPORT
+				const int avail_lines = max(1, height - 5 - gpus_extra_height);
+			#else
+				const int avail_lines = max(1, height - 5);
+			#endif
+				grid_label_width = 0;
+				for (const auto& group : core_groups)
+					grid_label_width = max(grid_label_width, (int)group.label.size() + 6);
+				auto lines_needed = [&](int cells) {
+					if (core_groups.empty()) return (int)ceil((double)Shared::coreCount / cells);
+					int lines{};
+					for (const auto& group : core_groups) lines += ceil((double)group.cores.size() / cells);
+					return lines;
+				};
+				grid_cells = max(8, (show_temp ? 32 : 20) - grid_label_width);
+				while (grid_cells + grid_label_width + 2 < width - width / 3 and lines_needed(grid_cells) > avail_lines) grid_cells++;
+				b_columns = 1;
+				b_column_size = 0;
+				b_width = grid_cells + grid_label_width + 2;
+			#ifdef GPU_SUPPORT
+				b_height = min(height - 2, lines_needed(grid_cells) + 4 + gpus_extra_height);
+			#else
+				b_height = min(height - 2, lines_needed(grid_cells) + 4);
+			#endif
+			}
+
 			b_x = x + width - b_width - 1;
 			b_y = y + ceil((double)(height - 2) / 2) - ceil((double)b_height / 2) + 1;
 
@@ -2158,7 +3337,10 @@ namespace Draw {
 			else
 				mem_width = width - 1;
 
-			item_height = has_swap and not swap_disk ? 6 : 4;
+			//? Mem::collect() selects the same extra stats and requests a resize when the selection changes
+			const auto extra_config = ssplit(Config::getS("mem_extra_stats"));
+			const auto extra_count = rng::count_if(extra_names, [&](Stat stat) { return v_contains(extra_config, stat_names[stat]); });
+			item_height = (has_swap and not swap_disk ? 6 : 4) + extra_count;
 			if (height - (has_swap and not swap_disk ? 3 : 2) > 2 * item_height)
 				mem_size = 3;
 			else if (mem_width > 25)
@@ -2185,6 +3367,12 @@ namespace Draw {
 			box += Mv::to(y, (show_disks ? divider + 2 : x + width - 9)) + Theme::c("mem_box") + Symbols::title_left + (show_disks ? Fx::b : "")
 				+ Theme::c("hi_fg") + 'd' + Theme::c("title") + "isks" + Fx::ub + Theme::c("mem_box") + Symbols::title_right;
 			Input::mouse_mappings["d"] = {y, (show_disks ? divider + 3 : x + width - 8), 1, 5};
+			if (show_disks) {
+				const auto& mem_panel = Config::getS("mem_panel");
+				box += Mv::to(y, divider + 9) + Symbols::title_left + (mem_panel != "disks" ? Fx::b : "") + Theme::c("hi_fg") + 'v'
+					+ Theme::c("title") + ' ' + mem_panel + Fx::ub + Theme::c("mem_box") + Symbols::title_right;
+				Input::mouse_mappings["v"] = {y, divider + 10, 1, (int)mem_panel.size() + 2};
+			}
 			if (show_disks) {
 				box += Mv::to(y, divider) + Symbols::div_up + Mv::to(y + height - 1, divider) + Symbols::div_down + Theme::c("div_line");
 				for (auto i : iota(1, height - 1))
@@ -2215,11 +3403,31 @@ namespace Draw {
 			b_height = (height > 10) ? 9 : height - 2;
 			b_x = x + width - b_width - 1;
 			b_y = y + ((height - 2) / 2) - b_height / 2 + 1;
+
+			//? Packets box with 4 stat lines and optional graph, then top talkers box with at least one line, below the stats box if there is room
+			int room = height - 2 - b_height;
+			p_height = (Config::getB("net_packet_stats") and room >= 6 ? min(room, (Config::getB("net_packet_graph") ? 9 : 6)) : 0);
+			room -= p_height;
+			const int top_talkers = Config::getI("net_top_talkers");
+			t_height = (top_talkers > 0 and room >= 3 ? min(top_talkers + 2, room) : 0);
+			if (p_height + t_height > 0) {
+				b_y = y + 1 + (height - 2 - b_height - p_height - t_height) / 2;
+				p_y = b_y + b_height;
+				t_y = p_y + p_height;
+			}
+
+			//? TCP/UDP box left of the stats box, taken from the graphs if they stay at least 20 wide
+			s_width = (Config::getB("net_proto_stats") and width - b_width - 2 - 22 >= 20 and b_height >= 3 ? 22 : 0);
+			s_x = b_x - s_width;
+			graph_width = width - b_width - 2 - s_width;
 			d_graph_height = round((double)(height - 2) / 2);
 			u_graph_height = height - 2 - d_graph_height;
 
 			box = createBox(x, y, width, height, Theme::c("net_box"), true, "net", "", 3);
 			box += createBox(b_x, b_y, b_width, b_height, "", false, "download", "upload");
+			if (p_height > 0) box += createBox(b_x, p_y, b_width, p_height, "", false, "packets");
+			if (s_width > 0) box += createBox(s_x, b_y, s_width, b_height, "", false, "tcp/udp");
+			if (t_height > 0) box += createBox(b_x, t_y, b_width, t_height, "", false, "top");
 		}
 
 		//* Calculate and draw proc box outlines
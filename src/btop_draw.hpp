@@ -95,11 +95,24 @@ namespace Draw {
 		Meter(const int width, const string& color_gradient, bool invert = false);
 
 		//* Return a string representation of the meter with given value
-		string operator()(int value);
+		const string& operator()(int value);
 	};
 
 	//* Class holding a percentage graph
 	class Graph {
+		//* Encoded columns of one graph row in a byte ring, read out in at most two spans starting at the oldest column
+		class Ring {
+			string buf;
+			vector<uint8_t> lengths;	// Byte length of each column
+			size_t head{}, bytes{}, first{}, columns{};
+			void grow(size_t need);
+		public:
+			void reserve(size_t columns, size_t column_bytes);
+			void push(std::string_view column);
+			void pop();
+			void append_to(string& out) const;
+		};
+
 		int width, height;
 		string color_gradient;
 		string out, symbol = "default";
@@ -107,7 +120,11 @@ namespace Draw {
 		long long offset;
 		long long last = 0, max_value = 0;
 		bool current = true, tty_mode = false;
-		std::unordered_map<bool, vector<string>> graphs = { {true, {}}, {false, {}}};
+		const vector<string>* glyphs{};				// 5x5 symbol table for symbol and direction
+		const array<string, 101>* gradient{};		// Colors of color_gradient, nullptr if not colored
+		uint64_t theme_generation{};				// Theme::generation <gradient> was resolved in
+		array<vector<Ring>, 2> rows;				// Rows of the two switching graphs
+		string next_row;							// Cursor move to the start of the next row
 
 		//* Create two representations of the graph to switch between to represent two values for each braille character
 		void _create(const deque<long long>& data, int data_offset);
@@ -128,6 +145,54 @@ namespace Draw {
 		string& operator()();
 	};
 
+	//* Model of the terminal screen that output is parsed into, only cells changed since the last frame are written out
+	class Frame {
+	public:
+		struct Cell {
+			uint64_t glyph{};		// UTF-8 bytes of the glyph, 0 if never written
+			uint32_t fg{}, bg{};	// 0 for default, COLOR_INDEX | index or COLOR_RGB | r << 16 | g << 8 | b
+			uint16_t attrs{};		// Fx attributes and WIDE_TAIL
+			bool operator==(const Cell&) const = default;
+		};
+		static constexpr uint32_t COLOR_INDEX = 1 << 24, COLOR_RGB = 2 << 24;
+		static constexpr uint16_t BOLD = 1, DIM = 2, ITALIC = 4, UNDERLINE = 8, BLINK = 16, REVERSE = 32, STRIKE = 64;
+		static constexpr uint16_t WIDE_TAIL = 1 << 15;	// Second column of a double width glyph
+
+	private:
+		int width{}, height{};
+		vector<Cell> cells, shown;
+		bool invalid{true};
+		int line{1}, col{1}, saved_line{1}, saved_col{1};
+		Cell pen{};
+
+		//? Pen and cursor of the terminal as left by the last diff(), unknown after something else wrote to it
+		Cell style{};
+		bool style_known{}, cursor_known{};
+		int cursor_line{}, cursor_col{};
+
+		void csi(std::string_view params, char command);
+		void sgr(std::string_view params);
+		void put(uint64_t glyph, int glyph_width);
+		void erase(int from, int to);
+
+	public:
+		bool use_rep{};		// Terminal supports REP for repeating the last character
+
+		//* Set screen size, clears the screen model if size changed
+		void resize(int width, int height);
+
+		//* Parse text, cursor moves and SGR sequences in <out> into the screen model
+		void write(std::string_view out);
+
+		//* Return escape sequences updating the terminal with cells changed since last call, using the shortest
+		//* cursor moves and only the SGR changes needed from the pen state left by the last call
+		string diff();
+
+		//* Terminal was written to outside of the frame, next diff() writes all cells
+		void invalidate() { invalid = true; }
+		bool valid() const { return not invalid; }
+	};
+
 	//* Calculate sizes of boxes, draw outlines and save to enabled boxes namespaces
 	void calcSizes();
 }
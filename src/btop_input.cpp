@@ -473,6 +473,13 @@ namespace Input {
 					no_update = false;
 					Draw::calcSizes();
 				}
+				else if (key == "v" and Config::getB("show_disks")) {
+					const auto& panels = Config::mem_panels;
+					const int i = v_index(panels, Config::getS("mem_panel"));
+					Config::set("mem_panel", panels.at((i + 1) % panels.size()));
+					no_update = false;
+					Draw::calcSizes();
+				}
 				else keep_going = true;
 
 				if (not keep_going) {
@@ -174,6 +174,7 @@ namespace Menu {
 		{"4", "Toggle PROC box."},
 		{"5", "Toggle GPU box."},
 		{"d", "Toggle disks view in MEM box."},
+		{"v", "Cycle panel shown next to memory in MEM box."},
 		{"F2, o", "Shows options."},
 		{"F1, ?, h", "Shows this window."},
 		{"ctrl + z", "Sleep program and put in background."},
@@ -341,6 +342,17 @@ namespace Menu {
 				"",
 				"Set this to false if the menus is flickering",
 				"too much for a comfortable experience."},
+			{"diff_output",
+				"Only write changed parts of the screen.",
+				"",
+				"Output is compared with the last update and",
+				"only changed cells are sent to the terminal,",
+				"greatly reduces output over slow connections",
+				"like ssh.",
+				"",
+				"Set to False if the screen gets garbled,",
+				"which can happen with terminals disagreeing",
+				"on the width of some characters."},
 			{"show_battery",
 				"Show battery stats.",
 				"(Only visible if cpu box is enabled!)",
@@ -389,6 +401,12 @@ namespace Menu {
 				"\"total\" = Total cpu usage. (Auto)",
 				"\"user\" = User mode cpu usage.",
 				"\"system\" = Kernel mode cpu usage.",
+				"\"pcores\", \"ecores\" = Performance/efficiency",
+				"cores on hybrid cpus.",
+				"\"physical\", \"smt\" = First/sibling threads",
+				"of each physical core.",
+				"\"pwr-package-0\", \"pwr-dram\" ... = RAPL power",
+				"draw in percent of the zone power limit.",
 				"+ more depending on kernel.",
 		#ifdef GPU_SUPPORT
 				"",
@@ -412,6 +430,12 @@ namespace Menu {
 				"\"total\" = Total cpu usage.",
 				"\"user\" = User mode cpu usage.",
 				"\"system\" = Kernel mode cpu usage.",
+				"\"pcores\", \"ecores\" = Performance/efficiency",
+				"cores on hybrid cpus.",
+				"\"physical\", \"smt\" = First/sibling threads",
+				"of each physical core.",
+				"\"pwr-package-0\", \"pwr-dram\" ... = RAPL power",
+				"draw in percent of the zone power limit.",
 				"+ more depending on kernel.",
 		#ifdef GPU_SUPPORT
 				"",
@@ -497,6 +521,38 @@ namespace Menu {
 				"",
 				"Can cause slowdowns on systems with many",
 				"cores and certain kernel versions."},
+			{"show_core_freq",
+				"Show per core frequency.",
+				"",
+				"Replaces the per core usage graphs with",
+				"current frequency of each core, colored",
+				"relative to the cores max frequency.",
+				"",
+				"Cores that have been thermal throttled",
+				"since last update are marked with \"!\".",
+				"",
+				"Only available on Linux."},
+			{"cpu_irq_matrix",
+				"Show interrupt rates instead of graphs.",
+				"",
+				"Shows the busiest interrupt lines from",
+				"/proc/interrupts and softirq types from",
+				"/proc/softirqs with rates for each cpu.",
+				"",
+				"Labels are colored by how much of the rate",
+				"is handled by a single cpu.",
+				"",
+				"Only available on Linux."},
+			{"cpu_core_layout",
+				"How to show cores in the cpu box.",
+				"",
+				"\"graphs\" = A graph and percentage per core.",
+				"",
+				"\"grid\" = A colored cell per core, grouped",
+				"by NUMA node, socket or L3 cache with the",
+				"average usage of each group.",
+				"",
+				"\"Auto\" = \"grid\" above 128 logical cpus."},
 			{"custom_cpu_name",
 				"Custom cpu model name in cpu percentage box.",
 				"",
@@ -568,10 +624,40 @@ namespace Menu {
 				"Show graphs for memory values.",
 				"",
 				"True or False."},
+			{"mem_extra_stats",
+				"Extra memory values to show.",
+				"",
+				"Space separated list of values shown as",
+				"meters or graphs below the memory values.",
+				"",
+				"Available: dirty writeback shmem mlocked",
+				"slab_reclaimable slab_unreclaimable",
+				"anon_hugepages hugepages_total",
+				"hugepages_free",
+				"",
+				"Percentages are of total memory.",
+				"(Linux only)"},
 			{"show_disks",
 				"Split memory box to also show disks.",
 				"",
 				"True or False."},
+			{"mem_panel",
+				"Panel shown next to memory values.",
+				"",
+				"Only shown if \"show_disks\" is True.",
+				"Cycle with key \"v\".",
+				"",
+				"\"disks\" = Disk usage and io.",
+				"\"numa\" = Memory usage and allocation",
+				"hit/miss/foreign rates per NUMA node.",
+				"(Linux only)",
+				"\"kernel\" = Context switches, forks, tasks,",
+				"page faults, swap in/out, page reclaim,",
+				"THP allocations and open file handles.",
+				"(Linux only)",
+				"\"swap\" = Usage and priority per swap area,",
+				"zram and zswap compression.",
+				"(Linux only)"},
 			{"show_io_stat",
 				"Toggle IO activity graphs.",
 				"",
@@ -579,6 +665,17 @@ namespace Menu {
 				"(disk busy time) when not in IO mode.",
 				"",
 				"True or False."},
+			{"io_graph_stat",
+				"Value shown in the small io graphs.",
+				"",
+				"\"activity\" = Disk busy time %.",
+				"\"iops\" = Read and write operations/s.",
+				"\"await\" = Average latency per operation.",
+				"\"queue\" = Average number of queued",
+				"operations.",
+				"\"discard\" = Bytes discarded per second.",
+				"",
+				"All but \"activity\" are Linux only."},
 			{"io_mode",
 				"Toggles io mode for disks.",
 				"",
@@ -625,6 +722,16 @@ namespace Menu {
 				"This also disables only_physical.",
 				"",
 				"True or False."},
+			{"disks_group",
+				"(Linux) Group container and RAM mounts.",
+				"",
+				"Collapses overlay, tmpfs and squashfs",
+				"mounts into one summary row per type.",
+				"",
+				"Mounts of an already listed block device,",
+				"like bind mounts, are hidden.",
+				"",
+				"True or False."},
 			{"zfs_hide_datasets",
 				"(Linux) Hide ZFS datasets in disks list.",
 				"",
@@ -705,6 +812,55 @@ namespace Menu {
 				"",
 				"Will otherwise automatically choose the NIC",
 				"with the highest total download since boot."},
+			{"net_groups",
+				"(Linux) Aggregated interface groups.",
+				"",
+				"Interfaces matching a glob pattern are",
+				"shown as one interface with their summed",
+				"traffic instead of one entry each.",
+				"",
+				"Space separated \"name=pattern,pattern\"",
+				"rules, for example:",
+				"\"veth=veth* pods=cali*,flannel*\""},
+			{"net_packet_stats",
+				"Show packet and error stats.",
+				"",
+				"Packets per second and average packet size",
+				"for download and upload, and per second",
+				"rates of dropped and missed packets,",
+				"transmit errors and fifo errors.",
+				"",
+				"Shown below the download/upload stats",
+				"if there is room.",
+				"",
+				"True or False."},
+			{"net_packet_graph",
+				"Show a packet rate graph.",
+				"",
+				"Adds a graph of received + transmitted",
+				"packets per second to the packet stats.",
+				"",
+				"True or False."},
+			{"net_proto_stats",
+				"(Linux) Show TCP/UDP health.",
+				"",
+				"Established TCP connections, active and",
+				"passive opens, retransmitted segments,",
+				"listen queue overflows and drops and UDP",
+				"receive buffer errors per second.",
+				"",
+				"Shown left of the download/upload stats",
+				"if the graphs stay wide enough.",
+				"",
+				"True or False."},
+			{"net_top_talkers",
+				"Number of busiest interfaces to list.",
+				"",
+				"Lists the interfaces with the highest",
+				"current download + upload rate below the",
+				"download/upload stats if there is room.",
+				"",
+				"0 to disable, max 50."},
 		},
 		{
 			{"proc_left",
@@ -777,6 +933,20 @@ namespace Menu {
 				"",
 				"Set to 'True' to filter out internal",
 				"processes started by the Linux kernel."},
+			{"proc_numa",
+				"(Linux) Show NUMA node column.",
+				"",
+				"Shows the NUMA node of the cpu each",
+				"process last ran on."},
+			{"proc_fds",
+				"(Linux) Show FDs and Sockets columns.",
+				"",
+				"Open file descriptors and how many of them",
+				"are sockets. Shown processes are counted",
+				"every update, the rest a few at a time.",
+				"Dimmed counts are older than a few updates.",
+				"",
+				"The detailed view adds the open files limit."},
 		}
 	};
 
@@ -1174,6 +1344,9 @@ namespace Menu {
 			{"color_theme", std::cref(Theme::themes)},
 			{"log_level", std::cref(Logger::log_levels)},
 			{"temp_scale", std::cref(Config::temp_scales)},
+			{"cpu_core_layout", std::cref(Config::cpu_core_layouts)},
+			{"mem_panel", std::cref(Config::mem_panels)},
+			{"io_graph_stat", std::cref(Config::io_graph_stats)},
 			{"proc_sorting", std::cref(Proc::sort_vector)},
 			{"graph_symbol", std::cref(Config::valid_graph_symbols)},
 			{"graph_symbol_cpu", std::cref(Config::valid_graph_symbols_def)},
@@ -1239,7 +1412,7 @@ namespace Menu {
 				const auto& option = categories[selected_cat][item_height * page + selected][0];
 				if (selPred.test(isString) and Config::stringValid(option, editor.text)) {
 					Config::set(option, editor.text);
-					if (option == "custom_cpu_name" or option.starts_with("custom_gpu_name"))
+					if (option == "custom_cpu_name" or option == "mem_extra_stats" or option.starts_with("custom_gpu_name"))
 						screen_redraw = true;
 					else if (is_in(option, "shown_boxes", "presets")) {
 						screen_redraw = true;
@@ -1256,6 +1429,8 @@ namespace Menu {
 				}
 				else if (selPred.test(isInt) and Config::intValid(option, editor.text)) {
 					Config::set(option, stoi(editor.text));
+					if (option == "net_top_talkers")
+						screen_redraw = true;
 				}
 				else
 					warnings = Config::validError;
@@ -1333,8 +1508,11 @@ namespace Menu {
 				if (key == "right" or (vim_keys and key == "l")) value += mod;
 				else value -= mod;
 
-				if (Config::intValid(option, to_string(value)))
+				if (Config::intValid(option, to_string(value))) {
 					Config::set(option, static_cast<int>(value));
+					if (option == "net_top_talkers")
+						screen_redraw = true;
+				}
 				else {
 					warnings = Config::validError;
 				}
@@ -1373,7 +1551,7 @@ namespace Menu {
 					Logger::set(optList.at(i));
 					Logger::info("Logger set to " + optList.at(i));
 				}
-				else if (is_in(option, "proc_sorting", "cpu_sensor", "show_gpu_info") or option.starts_with("graph_symbol") or option.starts_with("cpu_graph_"))
+				else if (is_in(option, "proc_sorting", "cpu_sensor", "show_gpu_info", "cpu_core_layout", "mem_panel", "io_graph_stat") or option.starts_with("graph_symbol") or option.starts_with("cpu_graph_"))
 					screen_redraw = true;
 			}
 			else
@@ -38,6 +38,32 @@ namespace Gpu {
 }
 #endif
 
+namespace Cpu {
+	vector<core_group> core_groups;
+}
+
+namespace Net {
+	vector<string> top_talkers;
+	array<uint64_t, PROTO_COUNT> proto_stats{};
+
+	void update_top_talkers(size_t count) {
+		top_talkers.clear();
+		count = std::min(count, interfaces.size());
+		if (count == 0) return;
+
+		//? Only the <count> busiest need to be ordered, the rest are left unsorted
+		vector<std::pair<uint64_t, const string*>> rates;
+		rates.reserve(interfaces.size());
+		for (const auto& iface : interfaces) {
+			const auto& stat = current_net.at(iface).stat;
+			rates.emplace_back(stat.at("download").speed + stat.at("upload").speed, &iface);
+		}
+		rng::partial_sort(rates, rates.begin() + count, [](const auto& a, const auto& b) { return a.first > b.first; });
+		for (size_t i = 0; i < count; i++)
+			top_talkers.push_back(*rates[i].second);
+	}
+}
+
 namespace Proc {
 	void proc_sorter(vector<proc_info>& proc_vec, const string& sorting, bool reverse, bool tree) {
 		if (reverse) {
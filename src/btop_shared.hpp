@@ -180,8 +180,8 @@ namespace Gpu {
 	//* Collect gpu stats and temperatures
     auto collect(bool no_update = false) -> vector<gpu_info>&;
 
-	//* Draw contents of gpu box using <gpus> as source
-  	string draw(const gpu_info& gpu, unsigned long index, bool force_redraw, bool data_same);
+	//* Draw contents of gpu box using <gpus> as source, appended to <out>
+  	void draw(string& out, const gpu_info& gpu, unsigned long index, bool force_redraw, bool data_same);
 #else
 	struct gpu_info {
 		bool supported = false;
@@ -198,6 +198,15 @@ namespace Cpu {
 	extern vector<string> available_sensors;
 	extern tuple<int, float, long, string> current_bat;
 
+	//* Interrupt line from /proc/interrupts or softirq type from /proc/softirqs
+	struct irq_info {
+		string name;
+		string desc;
+		bool softirq{};
+		vector<long long> rates;	// Per cpu, events per second
+		long long total{};
+	};
+
 	struct cpu_info {
 		std::unordered_map<string, deque<long long>> cpu_percent = {
 			{"total", {}},
@@ -216,13 +225,28 @@ namespace Cpu {
 		vector<deque<long long>> temp;
 		long long temp_max = 0;
 		array<double, 3> load_avg;
+		vector<long long> core_freq;		// Current MHz per core, empty if unsupported or disabled
+		vector<long long> core_freq_max;	// Max MHz per core, 0 if unknown
+		vector<long long> core_throttle;	// Thermal throttle events per core since last update
+		vector<long long> group_percent;	// Usage per entry in Cpu::core_groups
+		vector<irq_info> irqs;				// Interrupts followed by softirqs in file order
+		vector<size_t> irq_order;			// Indexes into irqs sorted by total rate
+		vector<long long> irq_cpu_total;	// Hardware interrupts per second per cpu
+		std::unordered_map<string, double> power_watts;	// Watts per RAPL domain, keyed by its cpu_percent field
+	};
+
+	//* Logical cpus sharing a NUMA node, package or L3 cache, used for the compact core grid
+	struct core_group {
+		string label;
+		vector<int> cores;
 	};
+	extern vector<core_group> core_groups;
 
 	//* Collect cpu stats and temperatures
 	auto collect(bool no_update = false) -> cpu_info&;
 
-	//* Draw contents of cpu box using <cpu> as source
-    string draw(const cpu_info& cpu, const vector<Gpu::gpu_info>& gpu, bool force_redraw = false, bool data_same = false);
+	//* Draw contents of cpu box using <cpu> as source, appended to <out>
+    void draw(string& out, const cpu_info& cpu, const vector<Gpu::gpu_info>& gpu, bool force_redraw = false, bool data_same = false);
 
 	//* Parse /proc/cpu info for mapping of core ids
 	auto get_core_mapping() -> std::unordered_map<int, int>;
@@ -238,36 +262,108 @@ namespace Mem {
 	extern string box;
 	extern int x, y, width, height, min_width, min_height;
 	extern bool has_swap, shown, redraw;
-	const array mem_names { "used"s, "available"s, "cached"s, "free"s };
-	const array swap_names { "swap_used"s, "swap_free"s };
+
+	//* Indexes into mem_info::stats
+	enum Stat : size_t {
+		USED, AVAILABLE, CACHED, FREE, SWAP_TOTAL, SWAP_USED, SWAP_FREE,
+		DIRTY, WRITEBACK, SHMEM, SLAB_RECLAIMABLE, SLAB_UNRECLAIMABLE, ANON_HUGEPAGES, HUGEPAGES_TOTAL, HUGEPAGES_FREE, MLOCKED,
+		STAT_COUNT
+	};
+
+	//* Names of Mem::Stat values, used as keys for mem_info::percent and in the config
+	const array<string, STAT_COUNT> stat_names {
+		"used"s, "available"s, "cached"s, "free"s, "swap_total"s, "swap_used"s, "swap_free"s,
+		"dirty"s, "writeback"s, "shmem"s, "slab_reclaimable"s, "slab_unreclaimable"s, "anon_hugepages"s, "hugepages_total"s, "hugepages_free"s, "mlocked"s
+	};
+
+	inline constexpr array mem_names { USED, AVAILABLE, CACHED, FREE };
+	inline constexpr array swap_names { SWAP_USED, SWAP_FREE };
+	inline constexpr array extra_names { DIRTY, WRITEBACK, SHMEM, SLAB_RECLAIMABLE, SLAB_UNRECLAIMABLE, ANON_HUGEPAGES, HUGEPAGES_TOTAL, HUGEPAGES_FREE, MLOCKED };
+
+	//* Indexes into kernel_info::values
+	enum Kernel : size_t {
+		CTXT, FORKS, RUNNING, BLOCKED, FAULTS, MAJFAULTS, SWAPIN, SWAPOUT, SCANNED, RECLAIMED, THP, FILES,
+		KERNEL_COUNT
+	};
+
+	//* Labels of Mem::Kernel values in the kernel panel
+	inline constexpr array<std::string_view, KERNEL_COUNT> kernel_labels {
+		"Ctx sw", "Forks", "Running", "Blocked", "Faults", "Maj flt", "Swap in", "Swp out", "Scanned", "Reclaim", "THP", "Files"
+	};
 	extern int disk_ios;
 
 	struct disk_info {
 		std::filesystem::path dev;
 		string name;
 		string fstype{};                // defaults to ""
-		std::filesystem::path stat{};   // defaults to ""
+		std::filesystem::path stat{};   // defaults to "", only used for ZFS
+		uint64_t devno{};				// Device number matched against /proc/diskstats, 0 if not a block device
 		int64_t total{};
 		int64_t used{};
 		int64_t free{};
 		int used_percent{};
 		int free_percent{};
+		bool stale{};					// Size query has not answered for a while, values are from the last answer
 
 		array<int64_t, 3> old_io = {0, 0, 0};
+		array<uint64_t, 6> old_ops = {0, 0, 0, 0, 0, 0};	// Reads, writes, ms reading, ms writing, weighted ms in queue, sectors discarded
 		deque<long long> io_read = {};
 		deque<long long> io_write = {};
 		deque<long long> io_activity = {};
+		deque<long long> io_iops = {};		// Read and write operations per second
+		deque<long long> io_await = {};		// Average wait per operation in microseconds
+		deque<long long> io_queue = {};		// Average queue depth times 100
+		deque<long long> io_discard = {};	// Bytes discarded per second
+	};
+
+	struct numa_info {
+		int node{};
+		uint64_t total{};
+		uint64_t used{};
+		uint64_t free{};
+		int used_percent{};
+		array<uint64_t, 3> old_stat = {0, 0, 0};	// numa_hit, numa_miss, numa_foreign in pages
+		array<uint64_t, 3> rates = {0, 0, 0};		// Bytes per second allocated for the above
+	};
+
+	//* Kernel activity from /proc/stat, /proc/vmstat and /proc/sys/fs/file-nr, rates are per second
+	struct kernel_info {
+		array<deque<long long>, KERNEL_COUNT> values;
+	};
+
+	//* A swap area from /proc/swaps, sizes in bytes
+	struct swap_device {
+		string name;
+		string type;				// "partition" or "file"
+		uint64_t size{};
+		uint64_t used{};
+		int priority{};
+		int used_percent{};
+		bool zram{};
+		uint64_t orig{};			// zram only, uncompressed size of stored pages
+		uint64_t compr{};			// zram only, compressed size of stored pages
+		uint64_t mem_used{};		// zram only, memory used including allocator overhead
+	};
+
+	//* Swap areas, zram and zswap, only collected when the swap panel is shown
+	struct swap_info {
+		vector<swap_device> devices;
+		uint64_t zswap_pool{};		// Memory used by the zswap pool
+		uint64_t zswapped{};		// Uncompressed size of pages stored in zswap
+		deque<long long> ratio;		// Compression ratio of zram and zswap combined, times 100
 	};
 
 	struct mem_info {
-		std::unordered_map<string, uint64_t> stats =
-			{{"used", 0}, {"available", 0}, {"cached", 0}, {"free", 0},
-			{"swap_total", 0}, {"swap_used", 0}, {"swap_free", 0}};
+		array<uint64_t, STAT_COUNT> stats{};	// Bytes, indexed by Mem::Stat
+		vector<Stat> extra_stats;				// Stats from extra_names selected in mem_extra_stats, in the order of extra_names
 		std::unordered_map<string, deque<long long>> percent =
 			{{"used", {}}, {"available", {}}, {"cached", {}}, {"free", {}},
 			{"swap_total", {}}, {"swap_used", {}}, {"swap_free", {}}};
 		std::unordered_map<string, disk_info> disks;
 		vector<string> disks_order;
+		vector<numa_info> numa;
+		kernel_info kernel;
+		swap_info swap;
 	};
 
 	//?* Get total system memory
@@ -276,8 +372,8 @@ namespace Mem {
 	//* Collect mem & disks stats
 	auto collect(bool no_update = false) -> mem_info&;
 
-	//* Draw contents of mem box using <mem> as source
-	string draw(const mem_info& mem, bool force_redraw = false, bool data_same = false);
+	//* Draw contents of mem box using <mem> as source, appended to <out>
+	void draw(string& out, const mem_info& mem, bool force_redraw = false, bool data_same = false);
 
 }
 
@@ -299,9 +395,18 @@ namespace Net {
 		uint64_t rollover{};
 	};
 
+	//* Packet and error counters read together with the byte counters, indexes for net_info::counters and net_info::rates
+	enum Counter : size_t {
+		RX_PACKETS, TX_PACKETS, RX_DROPPED, RX_MISSED, TX_ERRORS, FIFO_ERRORS,
+		COUNTER_COUNT
+	};
+
 	struct net_info {
 		std::unordered_map<string, deque<long long>> bandwidth = { {"download", {}}, {"upload", {}} };
 		std::unordered_map<string, net_stat> stat = { {"download", {}}, {"upload", {}} };
+		array<uint64_t, COUNTER_COUNT> counters{};	// Last read values
+		array<uint64_t, COUNTER_COUNT> rates{};		// Per second
+		deque<long long> packets = {};				// Received + transmitted packets per second
 		string ipv4{};      // defaults to ""
 		string ipv6{};      // defaults to ""
 		bool connected{};
@@ -320,11 +425,26 @@ namespace Net {
 
 	extern std::unordered_map<string, net_info> current_net;
 
+	//* TCP and UDP health from /proc/net/snmp and /proc/net/netstat, indexes for proto_stats
+	enum Proto : size_t {
+		TCP_ESTABLISHED, TCP_ACTIVE_OPENS, TCP_PASSIVE_OPENS, TCP_RETRANS, TCP_LISTEN_OVERFLOWS, TCP_LISTEN_DROPS, UDP_RCVBUF_ERRORS,
+		PROTO_COUNT
+	};
+
+	//* Current established connections, all others per second, only collected if net_proto_stats is set
+	extern array<uint64_t, PROTO_COUNT> proto_stats;
+
+	//* Interfaces with the highest current download + upload rate, busiest first
+	extern vector<string> top_talkers;
+
+	//* Select the <count> busiest of <interfaces> into top_talkers
+	void update_top_talkers(size_t count);
+
 	//* Collect net upload/download stats
 	auto collect(bool no_update=false) -> net_info&;
 
-	//* Draw contents of net box using <net> as source
-	string draw(const net_info& net, bool force_redraw = false, bool data_same = false);
+	//* Draw contents of net box using <net> as source, appended to <out>
+	void draw(string& out, const net_info& net, bool force_redraw = false, bool data_same = false);
 }
 
 namespace Proc {
@@ -387,6 +507,10 @@ namespace Proc {
 		size_t tree_index{};
 		bool collapsed{};
 		bool filtered{};
+		int numa_node = -1;		// Node of the cpu the process last ran on
+		int fds = -1;			// Open file descriptors, -1 if not counted or not readable
+		int sockets = -1;		// Open file descriptors that are sockets
+		uint64_t fd_time{};		// time_ms() when fds and sockets were counted
 	};
 
 	//* Container for process info box
@@ -394,7 +518,7 @@ namespace Proc {
 		size_t last_pid{};
 		bool skip_smaps{};
 		proc_info entry;
-		string elapsed, parent, status, io_read, io_write, memory;
+		string elapsed, parent, status, io_read, io_write, memory, fds;
 		long long first_mem = -1;
 		deque<long long> cpu_percent;
 		deque<long long> mem_bytes;
@@ -409,8 +533,8 @@ namespace Proc {
 	//* Update current selection and view, returns -1 if no change otherwise the current selection
 	int selection(const string& cmd_key);
 
-	//* Draw contents of proc box using <plist> as data source
-	string draw(const vector<proc_info>& plist, bool force_redraw = false, bool data_same = false);
+	//* Draw contents of proc box using <plist> as data source, appended to <out>
+	void draw(string& out, const vector<proc_info>& plist, bool force_redraw = false, bool data_same = false);
 
 	struct tree_proc {
 		std::reference_wrapper<proc_info> entry;
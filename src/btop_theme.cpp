@@ -45,6 +45,9 @@ namespace Theme {
 	std::unordered_map<string, string> colors;
 	std::unordered_map<string, array<int, 3>> rgbs;
 	std::unordered_map<string, array<string, 101>> gradients;
+	Tools::hashed_index<string> colors_index;
+	Tools::hashed_index<array<string, 101>> gradients_index;
+	std::atomic<uint64_t> generation;
 
 	const std::unordered_map<string, string> Default_theme = {
 		{ "main_bg", "#00" },
@@ -436,6 +439,9 @@ namespace Theme {
 			generateColors((theme == "Default" or theme_path.empty() ? Default_theme : loadFile(theme_path)));
 			generateGradients();
 		}
+		colors_index.build(colors);
+		gradients_index.build(gradients);
+		generation++;
 		Term::fg = colors.at("main_fg");
 		Term::bg = colors.at("main_bg");
 		Fx::reset = Fx::reset_base + Term::fg + Term::bg;
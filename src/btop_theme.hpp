@@ -19,11 +19,14 @@ tab-size = 4
 #pragma once
 
 #include <array>
+#include <atomic>
 #include <filesystem>
 #include <string>
 #include <vector>
 #include <unordered_map>
 
+#include "btop_tools.hpp"
+
 using std::array;
 using std::string;
 using std::vector;
@@ -57,11 +60,34 @@ namespace Theme {
 	extern std::unordered_map<string, array<int, 3>> rgbs;
 	extern std::unordered_map<string, array<string, 101>> gradients;
 
+	//? Indexes into colors and gradients for names hashed at compile time, rebuilt by setTheme()
+	extern Tools::hashed_index<string> colors_index;
+	extern Tools::hashed_index<array<string, 101>> gradients_index;
+
+	//* Incremented by setTheme() after colors and gradients are rebuilt, references into them from older generations are dangling
+	extern std::atomic<uint64_t> generation;
+
 	//* Return escape code for color <name>
-	inline const string& c(const string& name) { return colors.at(name); }
+	inline const string& c(const Tools::hashed_name& name) {
+		if (const string* color = colors_index.find(name)) return *color;
+		return colors.at(string{name.name});
+	}
+	template<Tools::runtime_name T>
+	inline const string& c(const T& name) {
+		if constexpr (std::is_same_v<T, string>) return colors.at(name);
+		else return colors.at(string{name});
+	}
 
 	//* Return array of escape codes for color gradient <name>
-	inline const array<string, 101>& g(string name) { return gradients.at(name); }
+	inline const array<string, 101>& g(const Tools::hashed_name& name) {
+		if (const auto* gradient = gradients_index.find(name)) return *gradient;
+		return gradients.at(string{name.name});
+	}
+	template<Tools::runtime_name T>
+	inline const array<string, 101>& g(const T& name) {
+		if constexpr (std::is_same_v<T, string>) return gradients.at(name);
+		else return gradients.at(string{name});
+	}
 
 	//* Return array of red, green and blue in decimal for color <name>
 	inline const std::array<int, 3>& dec(string name) { return rgbs.at(name); }
@@ -16,8 +16,10 @@ indent = tab
 tab-size = 4
 */
 
+#include <cerrno>
 #include <cmath>
-#include <codecvt>
+#include <cstring>
+#include <limits>
 #include <iostream>
 #include <fstream>
 #include <ctime>
@@ -182,86 +184,175 @@ namespace Term {
 
 //? --------------------------------------------------- FUNCTIONS -----------------------------------------------------
 
-// ! Disabled due to issue when compiling with musl, reverted back to using regex
-// namespace Fx {
-// 	string uncolor(const string& s) {
-// 		string out = s;
-// 		for (size_t offset = 0, start_pos = 0, end_pos = 0;;) {
-// 			start_pos = (offset == 0) ? out.find('\x1b') : offset;
-// 			if (start_pos == string::npos)
-// 				break;
-// 			offset = start_pos + 1;
-// 			end_pos = out.find('m', offset);
-// 			if (end_pos == string::npos)
-// 				break;
-// 			else if (auto next_pos = out.find('\x1b', offset); not isdigit(out[end_pos - 1]) or end_pos > next_pos) {
-// 			 	offset = next_pos;
-// 				continue;
-// 			}
-
-// 			out.erase(start_pos, (end_pos - start_pos)+1);
-// 			offset = 0;
-// 		}
-// 		out.shrink_to_fit();
-// 		return out;
-// 	}
-// }
+namespace Fx {
+	void uncolor_to(string& out, const std::string_view s) {
+		const auto is_digit = [](char c) { return c >= '0' and c <= '9'; };
+		out.reserve(out.size() + s.size());
+		size_t start = 0;
+		for (size_t pos = s.find('\x1b'); pos != string_view::npos; pos = s.find('\x1b', pos + 1)) {
+			//? Color and style sequences are ESC [ followed by digits and semicolons, starting with a digit and ending with m
+			if (pos + 2 >= s.size() or s[pos + 1] != '[' or not is_digit(s[pos + 2])) continue;
+			size_t end = pos + 3;
+			while (end < s.size() and (is_digit(s[end]) or s[end] == ';')) end++;
+			if (end == s.size() or s[end] != 'm') continue;
+
+			out.append(s.substr(start, pos - start));
+			start = end + 1;
+			pos = end;
+		}
+		out.append(s.substr(start));
+	}
+
+	string uncolor(const std::string_view s) {
+		string out;
+		uncolor_to(out, s);
+		return out;
+	}
+}
 
 namespace Tools {
 
-	size_t wide_ulen(const string& str) {
-		unsigned int chars = 0;
-		try {
-			std::wstring_convert<std::codecvt_utf8<wchar_t>> conv;
-			auto w_str = conv.from_bytes((str.size() > 10000 ? str.substr(0, 10000).c_str() : str.c_str()));
+	namespace {
+		//* Two-level table of terminal column widths for every unicode codepoint, built once from the ranges in widechar_width.hpp
+		class WidthTable {
+			static constexpr uint32_t block_bits = 8;
+			static constexpr uint32_t block_size = 1 << block_bits;
+			static constexpr uint32_t codepoints = 0x110000;
+
+			array<uint16_t, codepoints / block_size> blocks;
+			vector<uint8_t> widths;
+
+		public:
+			WidthTable() {
+				//? Paint the ranges in reverse order of precedence in utf8::wcwidth(), so the first matching range wins
+				vector<uint8_t> full(codepoints, 1);
+				auto paint = [&full](const auto& table, uint8_t width) {
+					for (const auto& range : table)
+						std::fill(full.begin() + range.lo, full.begin() + std::min(range.hi + 1, codepoints), width);
+				};
+				paint(utf8::widechar_widened_table, utf8::widechar_widened_in_9);
+				paint(utf8::widechar_unassigned_table, utf8::widechar_unassigned);
+				paint(utf8::widechar_ambiguous_table, utf8::widechar_ambiguous);
+				paint(utf8::widechar_doublewide_table, 2);
+				paint(utf8::widechar_combiningletters_table, utf8::widechar_combining);
+				paint(utf8::widechar_combining_table, utf8::widechar_combining);
+				paint(utf8::widechar_nonchar_table, utf8::widechar_non_character);
+				paint(utf8::widechar_nonprint_table, utf8::widechar_nonprint);
+				paint(utf8::widechar_private_table, utf8::widechar_private_use);
+				paint(utf8::widechar_ascii_table, 1);
+
+				//? Store each distinct block of widths once and point all blocks with the same content to it
+				std::unordered_map<string_view, uint16_t> seen;
+				for (uint32_t block = 0; block < blocks.size(); block++) {
+					const string_view content{reinterpret_cast<const char*>(full.data()) + block * block_size, block_size};
+					auto [it, inserted] = seen.try_emplace(content, static_cast<uint16_t>(seen.size()));
+					if (inserted) widths.insert(widths.end(), full.begin() + block * block_size, full.begin() + (block + 1) * block_size);
+					blocks[block] = it->second;
+				}
+				widths.shrink_to_fit();
+			}
 
-			for (auto c : w_str) {
-				chars += utf8::wcwidth(c);
+			int operator()(uint32_t c) const {
+				if (c >= codepoints) return 1;
+				return widths[(static_cast<uint32_t>(blocks[c >> block_bits]) << block_bits) | (c & (block_size - 1))];
 			}
-		}
-		catch (...) {
-			return ulen(str);
-		}
+		};
 
-		return chars;
-	}
+		const WidthTable& width_table() {
+			static const WidthTable table;
+			return table;
+		}
+
+		//* Decode the UTF-8 sequence at <str>[<i>] into <c>, returns the length of the sequence or 0 if it's invalid.
+		//* A sequence cut short by the end of <str> returns its full length, leaving <c> incomplete
+		inline size_t utf8_decode(const string_view str, const size_t i, uint32_t& c) {
+			const auto byte = [&str](size_t pos) { return static_cast<unsigned char>(str[pos]); };
+			const unsigned char lead = byte(i);
+			size_t len;
+			if (lead < 0x80) { c = lead; return 1; }
+			else if (lead < 0xC2) return 0;
+			else if (lead < 0xE0) { len = 2; c = lead & 0x1F; }
+			else if (lead < 0xF0) { len = 3; c = lead & 0x0F; }
+			else if (lead < 0xF5) { len = 4; c = lead & 0x07; }
+			else return 0;
+
+			for (size_t b = 1; b < len and i + b < str.size(); b++) {
+				if ((byte(i + b) & 0xC0) != 0x80) return 0;
+				c = (c << 6) | (byte(i + b) & 0x3F);
+			}
+			//? Reject overlong encodings and codepoints above U+10FFFF
+			if (i + len <= str.size() and ((len == 3 and c < 0x800) or (len == 4 and (c < 0x10000 or c > 0x10FFFF)))) return 0;
+			return len;
+		}
+
+		constexpr uint64_t repeat_byte(uint8_t b) { return 0x0101010101010101ULL * b; }
+	}
+
+	ufit_result ufit(const std::string_view str, const size_t len, bool wide) {
+		const auto& widths = width_table();
+		ufit_result result;
+		bool fits = true;
+		size_t i = 0;
+
+		while (i < str.size()) {
+			//? Fast path for runs of 8 ASCII bytes, which are all 1 column wide unless they are control characters
+			if (i + 8 <= str.size()) {
+				uint64_t word;
+				std::memcpy(&word, str.data() + i, 8);
+				if (((wide ? (word | (word - repeat_byte(0x20)) | (word + repeat_byte(0x01))) : word) & repeat_byte(0x80)) == 0) {
+					if (fits and result.width + 8 > len) {
+						fits = false;
+						result.bytes = i + (len - result.width);
+					}
+					result.width += 8;
+					result.chars += 8;
+					i += 8;
+					continue;
+				}
+			}
 
-	size_t wide_ulen(const std::wstring& w_str) {
-		unsigned int chars = 0;
+			size_t seq_len = 1;
+			int width;
+			if (wide) {
+				uint32_t c;
+				if ((seq_len = utf8_decode(str, i, c)) == 0) return ufit(str, len, false);
+				result.chars++;
+				//? Incomplete sequence at the end takes no columns and is left out when cutting
+				if (i + seq_len > str.size()) {
+					if (fits) result.bytes = i;
+					return result;
+				}
+				width = widths(c);
+			}
+			else {
+				width = ((static_cast<unsigned char>(str[i]) & 0xC0) != 0x80);
+				result.chars += width;
+			}
 
-		for (auto c : w_str) {
-			chars += utf8::wcwidth(c);
+			if (fits and result.width + width > len) {
+				fits = false;
+				result.bytes = i;
+			}
+			result.width += width;
+			i += seq_len;
 		}
+		if (fits) result.bytes = str.size();
+		return result;
+	}
+
+	size_t wide_ulen(const std::string_view str) {
+		return ufit(str, std::numeric_limits<size_t>::max(), true).width;
+	}
 
-		return chars;
+	int char_width(uint32_t c) {
+		return width_table()(c);
 	}
 
 	string uresize(string str, const size_t len, bool wide) {
 		if (len < 1 or str.empty())
 			return "";
 
-		if (wide) {
-			try {
-				std::wstring_convert<std::codecvt_utf8<wchar_t>> conv;
-				auto w_str = conv.from_bytes((str.size() > 10000 ? str.substr(0, 10000).c_str() : str.c_str()));
-				while (wide_ulen(w_str) > len)
-					w_str.pop_back();
-				string n_str = conv.to_bytes(w_str);
-				return n_str;
-			}
-			catch (...) {
-				return uresize(str, len, false);
-			}
-		}
-		else {
-			for (size_t x = 0, i = 0; i < str.size(); i++) {
-				if ((static_cast<unsigned char>(str.at(i)) & 0xC0) != 0x80) x++;
-				if (x >= len + 1) {
-					str.resize(i);
-					break;
-				}
-			}
-		}
+		str.resize(ufit(str, len, wide).bytes);
 		str.shrink_to_fit();
 		return str;
 	}
@@ -323,52 +414,54 @@ namespace Tools {
 		return out;
 	}
 
-	string ljust(string str, const size_t x, bool utf, bool wide, bool limit) {
-		if (utf) {
-			if (limit and ulen(str, wide) > x)
-				return uresize(str, x, wide);
-
-			return str + string(max((int)(x - ulen(str)), 0), ' ');
-		}
-		else {
-			if (limit and str.size() > x) {
-				str.resize(x);
-				return str;
-			}
-			return str + string(max((int)(x - str.size()), 0), ' ');
+	void ljust_to(string& out, const std::string_view str, const size_t x, bool utf, bool wide, bool limit) {
+		const auto fit = (utf ? ufit(str, x, wide) : ufit_result{str.size(), str.size(), std::min(str.size(), x)});
+		if (limit and fit.width > x) {
+			out.append(str.substr(0, fit.bytes));
+			return;
 		}
+		out.append(str);
+		if (x > fit.chars) out.append(x - fit.chars, ' ');
 	}
 
-	string rjust(string str, const size_t x, bool utf, bool wide, bool limit) {
-		if (utf) {
-			if (limit and ulen(str, wide) > x)
-				return uresize(str, x, wide);
-
-			return string(max((int)(x - ulen(str)), 0), ' ') + str;
+	void rjust_to(string& out, const std::string_view str, const size_t x, bool utf, bool wide, bool limit) {
+		const auto fit = (utf ? ufit(str, x, wide) : ufit_result{str.size(), str.size(), std::min(str.size(), x)});
+		if (limit and fit.width > x) {
+			out.append(str.substr(0, fit.bytes));
+			return;
 		}
-		else {
-			if (limit and str.size() > x) {
-				str.resize(x);
-				return str;
-			};
-			return string(max((int)(x - str.size()), 0), ' ') + str;
+		if (x > fit.chars) out.append(x - fit.chars, ' ');
+		out.append(str);
+	}
+
+	void cjust_to(string& out, const std::string_view str, const size_t x, bool utf, bool wide, bool limit) {
+		const auto fit = (utf ? ufit(str, x, wide) : ufit_result{str.size(), str.size(), std::min(str.size(), x)});
+		if (limit and fit.width > x) {
+			out.append(str.substr(0, fit.bytes));
+			return;
 		}
+		const size_t pad = (x > fit.chars ? x - fit.chars : 0);
+		out.append(pad - pad / 2, ' ');
+		out.append(str);
+		out.append(pad / 2, ' ');
 	}
 
-	string cjust(string str, const size_t x, bool utf, bool wide, bool limit) {
-		if (utf) {
-			if (limit and ulen(str, wide) > x)
-				return uresize(str, x, wide);
+	string ljust(const std::string_view str, const size_t x, bool utf, bool wide, bool limit) {
+		string out;
+		ljust_to(out, str, x, utf, wide, limit);
+		return out;
+	}
 
-			return string(max((int)ceil((double)(x - ulen(str)) / 2), 0), ' ') + str + string(max((int)floor((double)(x - ulen(str)) / 2), 0), ' ');
-		}
-		else {
-			if (limit and str.size() > x) {
-				str.resize(x);
-				return str;
-			}
-			return string(max((int)ceil((double)(x - str.size()) / 2), 0), ' ') + str + string(max((int)floor((double)(x - str.size()) / 2), 0), ' ');
-		}
+	string rjust(const std::string_view str, const size_t x, bool utf, bool wide, bool limit) {
+		string out;
+		rjust_to(out, str, x, utf, wide, limit);
+		return out;
+	}
+
+	string cjust(const std::string_view str, const size_t x, bool utf, bool wide, bool limit) {
+		string out;
+		cjust_to(out, str, x, utf, wide, limit);
+		return out;
 	}
 
 	string trans(const string& str) {
@@ -396,6 +489,19 @@ namespace Tools {
 		return out;
 	}
 
+	string count_humanizer(uint64_t value) {
+		static const array suffixes { ""s, "k"s, "M"s, "G"s, "T"s, "P"s };
+		size_t i = 0;
+		uint64_t rest = 0;
+		while (value >= 1000 and i < suffixes.size() - 1) {
+			rest = value % 1000;
+			value /= 1000;
+			i++;
+		}
+		if (i > 0 and value < 10) return to_string(value) + '.' + to_string(rest / 100) + suffixes[i];
+		return to_string(value) + suffixes[i];
+	}
+
 	string floating_humanizer(uint64_t value, bool shorten, size_t start, bool bit, bool per_second) {
 		string out;
 		const size_t mult = (bit) ? 8 : 1;
@@ -541,6 +647,29 @@ namespace Tools {
 		return (out.empty() ? fallback : out);
 	}
 
+	bool read_all(const std::filesystem::path& path, string& buf) {
+		const int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+		if (fd < 0) return false;
+		if (buf.capacity() < 4096) buf.reserve(4096);
+		buf.resize(buf.capacity());
+		size_t len = 0;
+		while (true) {
+			const ssize_t got = read(fd, buf.data() + len, buf.size() - len);
+			if (got < 0) {
+				if (errno == EINTR) continue;
+				close(fd);
+				buf.clear();
+				return false;
+			}
+			if (got == 0) break;
+			len += static_cast<size_t>(got);
+			if (len == buf.size()) buf.resize(buf.size() * 2);
+		}
+		close(fd);
+		buf.resize(len);
+		return true;
+	}
+
 	auto celsius_to(const long long& celsius, const string& scale) -> tuple<long long, string> {
 		if (scale == "celsius")
 			return {celsius, "°C"};
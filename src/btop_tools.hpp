@@ -25,10 +25,11 @@ tab-size = 4
 #include <algorithm>        // for std::ranges::count_if
 #include <array>
 #include <atomic>
+#include <bit>
 #include <chrono>
 #include <filesystem>
+#include <iterator>
 #include <ranges>
-#include <regex>
 #include <string>
 #include <thread>
 #include <tuple>
@@ -82,34 +83,39 @@ namespace Fx {
 	//* Reset text effects and restore theme foregrund and background color
 	extern string reset;
 
-	//* Regex for matching color, style and cursor move escape sequences
-	const std::regex escape_regex("\033\\[\\d+;?\\d?;?\\d*;?\\d*;?\\d*(m|f|s|u|C|D|A|B){1}");
-
-	//* Regex for matching only color and style escape sequences
-	const std::regex color_regex("\033\\[\\d+;?\\d?;?\\d*;?\\d*;?\\d*(m){1}");
+	//* Append <s> with all colors and text styling removed to <out>
+	void uncolor_to(string& out, const std::string_view s);
 
 	//* Return a string with all colors and text styling removed
-	inline string uncolor(const string& s) { return std::regex_replace(s, color_regex, ""); }
-	// string uncolor(const string& s);
+	string uncolor(const std::string_view s);
 
 }
 
 //* Collection of escape codes and functions for cursor manipulation
 namespace Mv {
 	//* Move cursor to <line>, <column>
-	inline string to(int line, int col) { return Fx::e + to_string(line) + ';' + to_string(col) + 'f'; }
+	inline string to(int line, int col) { return fmt::format("\x1b[{};{}f", line, col); }
 
 	//* Move cursor right <x> columns
-	inline string r(int x) { return Fx::e + to_string(x) + 'C'; }
+	inline string r(int x) { return fmt::format("\x1b[{}C", x); }
 
 	//* Move cursor left <x> columns
-	inline string l(int x) { return Fx::e + to_string(x) + 'D'; }
+	inline string l(int x) { return fmt::format("\x1b[{}D", x); }
 
 	//* Move cursor up x lines
-	inline string u(int x) { return Fx::e + to_string(x) + 'A'; }
+	inline string u(int x) { return fmt::format("\x1b[{}A", x); }
 
 	//* Move cursor down x lines
-	inline string d(int x) { return Fx::e + to_string(x) + 'B'; }
+	inline string d(int x) { return fmt::format("\x1b[{}B", x); }
+
+	//* Append move cursor to <line>, <column> to <out>
+	inline void to(string& out, int line, int col) { fmt::format_to(std::back_inserter(out), "\x1b[{};{}f", line, col); }
+
+	//* Append move cursor right <x> columns to <out>
+	inline void r(string& out, int x) { fmt::format_to(std::back_inserter(out), "\x1b[{}C", x); }
+
+	//* Append move cursor left <x> columns to <out>
+	inline void l(string& out, int x) { fmt::format_to(std::back_inserter(out), "\x1b[{}D", x); }
 
 	//* Save cursor position
 	const string save = Fx::e + "s";
@@ -186,17 +192,88 @@ namespace Logger {
 namespace Tools {
 	constexpr auto SSmax = std::numeric_limits<std::streamsize>::max();
 
+	//* FNV-1a hash of <str>, continuing from <hash> when given
+	constexpr uint64_t fnv1a(std::string_view str, uint64_t hash = 0xcbf29ce484222325) {
+		for (const char c : str) {
+			hash ^= static_cast<unsigned char>(c);
+			hash *= 0x100000001b3;
+		}
+		return hash;
+	}
+
+	//* A key name given as a string literal, hashed at compile time
+	struct hashed_name {
+		uint64_t hash;
+		std::string_view name;
+		template<size_t N>
+		consteval hashed_name(const char (&name)[N]) : hash(fnv1a({name, N - 1})), name(name, N - 1) {}
+	};
+
+	//* Open addressing index from name hashes to the values of a node based map, values must not be erased while indexed
+	template<typename T>
+	class hashed_index {
+		vector<std::pair<uint64_t, T*>> slots;
+		size_t mask{};
+	public:
+		hashed_index() = default;
+		template<typename Map>
+		explicit hashed_index(Map& map) { build(map); }
+
+		template<typename Map>
+		void build(Map& map) {
+			slots.assign(std::bit_ceil(map.size() * 2 + 1), {0, nullptr});
+			mask = slots.size() - 1;
+			for (auto& [name, value] : map) {
+				const uint64_t hash = fnv1a(name);
+				size_t i = hash & mask;
+				for (; slots[i].second != nullptr; i = (i + 1) & mask) {
+					//? Leave the index empty on a hash collision so all lookups fall back to the map
+					if (slots[i].first == hash) {
+						slots.clear();
+						return;
+					}
+				}
+				slots[i] = {hash, &value};
+			}
+		}
+
+		//* Return pointer to value for <name> or nullptr if not indexed
+		T* find(const hashed_name& name) const {
+			if (slots.empty()) return nullptr;
+			for (size_t i = name.hash & mask; slots[i].second != nullptr; i = (i + 1) & mask) {
+				if (slots[i].first == name.hash) return slots[i].second;
+			}
+			return nullptr;
+		}
+	};
+
+	//* Matches string types passed by value at runtime, but not string literals which convert to hashed_name
+	template<typename T>
+	concept runtime_name = not std::is_array_v<T> and std::convertible_to<const T&, std::string_view>;
+
 	class MyNumPunct : public std::numpunct<char> {
 	protected:
 		virtual char do_thousands_sep() const { return '\''; }
 		virtual std::string do_grouping() const { return "\03"; }
 	};
 
-	size_t wide_ulen(const string& str);
-	size_t wide_ulen(const std::wstring& w_str);
+	//* Size of a UTF8 string and the length in bytes of its longest prefix fitting in a given number of columns
+	struct ufit_result {
+		size_t width{};	//? Columns used on terminal if measured wide, else same as chars
+		size_t chars{};	//? Number of UTF8 characters
+		size_t bytes{};	//? Bytes to keep to fit in the requested columns
+	};
+
+	//* Measure <str> and find where to cut it to fit in <len> columns in a single pass (wide=true for column size needed on terminal)
+	ufit_result ufit(const std::string_view str, const size_t len, bool wide = false);
+
+	size_t wide_ulen(const std::string_view str);
+
+	//* Return number of terminal columns used by unicode codepoint <c>, 0 for combining characters
+	int char_width(uint32_t c);
 
 	//* Return number of UTF8 characters in a string (wide=true for column size needed on terminal)
-	inline size_t ulen(const string& str, bool wide = false) {
+	inline size_t ulen(const std::string_view str, bool wide = false) {
 		return (wide ? wide_ulen(str) : std::ranges::count_if(str, [](char c) { return (static_cast<unsigned char>(c) & 0xC0) != 0x80; }));
 	}
 
@@ -276,6 +353,11 @@ namespace Tools {
 		return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
 	}
 
+#ifdef BTOP_DEBUG
+	//* Number of heap allocations made by the calling thread, counted by the replaced operator new in btop.cpp
+	extern thread_local uint64_t allocations;
+#endif
+
 	//* Check if a string is a valid bool value
 	inline bool isbool(const string& str) {
 		return is_in(str, "true", "false", "True", "False");
@@ -316,13 +398,22 @@ namespace Tools {
 	}
 
 	//* Left justify string <str> if <x> is greater than <str> length, limit return size to <x> by default
-	string ljust(string str, const size_t x, bool utf = false, bool wide = false, bool limit = true);
+	string ljust(const std::string_view str, const size_t x, bool utf = false, bool wide = false, bool limit = true);
+
+	//* Append ljust(<str>, <x>, ...) to <out> without creating any temporary strings
+	void ljust_to(string& out, const std::string_view str, const size_t x, bool utf = false, bool wide = false, bool limit = true);
 
 	//* Right justify string <str> if <x> is greater than <str> length, limit return size to <x> by default
-	string rjust(string str, const size_t x, bool utf = false, bool wide = false, bool limit = true);
+	string rjust(const std::string_view str, const size_t x, bool utf = false, bool wide = false, bool limit = true);
+
+	//* Append rjust(<str>, <x>, ...) to <out> without creating any temporary strings
+	void rjust_to(string& out, const std::string_view str, const size_t x, bool utf = false, bool wide = false, bool limit = true);
 
 	//* Center justify string <str> if <x> is greater than <str> length, limit return size to <x> by default
-	string cjust(string str, const size_t x, bool utf = false, bool wide = false, bool limit = true);
+	string cjust(const std::string_view str, const size_t x, bool utf = false, bool wide = false, bool limit = true);
+
+	//* Append cjust(<str>, <x>, ...) to <out> without creating any temporary strings
+	void cjust_to(string& out, const std::string_view str, const size_t x, bool utf = false, bool wide = false, bool limit = true);
 
 	//* Replace whitespaces " " with escape code for move right
 	string trans(const string& str);
@@ -336,12 +427,22 @@ namespace Tools {
 	//* short=True always returns 0 decimals and shortens unit to 1 character
 	string floating_humanizer(uint64_t value, bool shorten = false, size_t start = 0, bool bit = false, bool per_second = false);
 
+	//* Shorten a plain count to at most 4 characters using k, M and G suffixes, e.g. 12345 -> "12k"
+	string count_humanizer(uint64_t value);
+
 	//* Add std::string operator * : Repeat string <str> <n> number of times
 	std::string operator*(const string& str, int64_t n);
 
+	//* Shared default constructed value of type <T>, used as fallback by safeVal() so containers aren't constructed on every call
+	template <typename T>
+	const T& default_value() {
+		static const T value{};
+		return value;
+	}
+
 	template <typename K, typename T>
 #ifdef BTOP_DEBUG
-	const T& safeVal(const std::unordered_map<K, T>& map, const K& key, const T& fallback = T{}, std::source_location loc = std::source_location::current()) {
+	const T& safeVal(const std::unordered_map<K, T>& map, const K& key, const T& fallback = default_value<T>(), std::source_location loc = std::source_location::current()) {
 		if (map.contains(key)) {
 			return map.at(key);
 		} else {
@@ -350,7 +451,7 @@ namespace Tools {
 		}
 	};
 #else
-	const T& safeVal(const std::unordered_map<K, T>& map, const K& key, const T& fallback = T{}) {
+	const T& safeVal(const std::unordered_map<K, T>& map, const K& key, const T& fallback = default_value<T>()) {
 		if (map.contains(key)) {
 			return map.at(key);
 		} else {
@@ -362,7 +463,7 @@ namespace Tools {
 
 	template <typename T>
 #ifdef BTOP_DEBUG
-	const T& safeVal(const std::vector<T>& vec, const size_t& index, const T& fallback = T{}, std::source_location loc = std::source_location::current()) {
+	const T& safeVal(const std::vector<T>& vec, const size_t& index, const T& fallback = default_value<T>(), std::source_location loc = std::source_location::current()) {
 		if (index < vec.size()) {
 			return vec.at(index);
 		} else {
@@ -371,7 +472,7 @@ namespace Tools {
 		}
 	};
 #else
-	const T& safeVal(const std::vector<T>& vec, const size_t& index, const T& fallback = T{}) {
+	const T& safeVal(const std::vector<T>& vec, const size_t& index, const T& fallback = default_value<T>()) {
 		if (index < vec.size()) {
 			return vec.at(index);
 		} else {
@@ -417,6 +518,9 @@ namespace Tools {
 	//* Read a complete file and return as a string
 	string readfile(const std::filesystem::path& path, const string& fallback = "");
 
+	//* Read the whole of <path> into <buf>, reusing its capacity between calls, returns false on failure
+	bool read_all(const std::filesystem::path& path, string& buf);
+
 	//* Convert a celsius value to celsius, fahrenheit, kelvin or rankin and return tuple with new value and unit.
 	auto celsius_to(const long long& celsius, const string& scale) -> tuple<long long, string>;
 }
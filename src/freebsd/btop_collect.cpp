@@ -644,20 +644,20 @@ namespace Mem {
 		sysctl(mib, 4, &(memWire), &len, nullptr, 0);
 		memWire *= Shared::pageSize;
 
-		mem.stats.at("used") = memWire + memActive;
-		mem.stats.at("available") = Shared::totalMem - memActive - memWire;
+		mem.stats[USED] = memWire + memActive;
+		mem.stats[AVAILABLE] = Shared::totalMem - memActive - memWire;
 
 		len = sizeof(cachedMem);
    		len = 4; sysctlnametomib("vm.stats.vm.v_cache_count", mib, &len);
    		sysctl(mib, 4, &(cachedMem), &len, nullptr, 0);
    		cachedMem *= Shared::pageSize;
-   		mem.stats.at("cached") = cachedMem;
+   		mem.stats[CACHED] = cachedMem;
 
 		len = sizeof(freeMem);
    		len = 4; sysctlnametomib("vm.stats.vm.v_free_count", mib, &len);
    		sysctl(mib, 4, &(freeMem), &len, nullptr, 0);
    		freeMem *= Shared::pageSize;
-   		mem.stats.at("free") = freeMem;
+   		mem.stats[FREE] = freeMem;
 
 		if (show_swap) {
 			char buf[_POSIX2_LINE_MAX];
@@ -669,24 +669,24 @@ namespace Mem {
 				totalSwap += swap[i].ksw_total;
 				usedSwap += swap[i].ksw_used;
 			}
-			mem.stats.at("swap_total") = totalSwap * Shared::pageSize;
-			mem.stats.at("swap_used") = usedSwap * Shared::pageSize;
+			mem.stats[SWAP_TOTAL] = totalSwap * Shared::pageSize;
+			mem.stats[SWAP_USED] = usedSwap * Shared::pageSize;
 		}
 
-		if (show_swap and mem.stats.at("swap_total") > 0) {
-			for (const auto &name : swap_names) {
-				mem.percent.at(name).push_back(round((double)mem.stats.at(name) * 100 / mem.stats.at("swap_total")));
-				while (cmp_greater(mem.percent.at(name).size(), width * 2))
-					mem.percent.at(name).pop_front();
+		if (show_swap and mem.stats[SWAP_TOTAL] > 0) {
+			for (const auto &stat : swap_names) {
+				mem.percent.at(stat_names[stat]).push_back(round((double)mem.stats[stat] * 100 / mem.stats[SWAP_TOTAL]));
+				while (cmp_greater(mem.percent.at(stat_names[stat]).size(), width * 2))
+					mem.percent.at(stat_names[stat]).pop_front();
 			}
 			has_swap = true;
 		} else
 			has_swap = false;
 		//? Calculate percentages
-		for (const auto &name : mem_names) {
-			mem.percent.at(name).push_back(round((double)mem.stats.at(name) * 100 / Shared::totalMem));
-			while (cmp_greater(mem.percent.at(name).size(), width * 2))
-				mem.percent.at(name).pop_front();
+		for (const auto &stat : mem_names) {
+			mem.percent.at(stat_names[stat]).push_back(round((double)mem.stats[stat] * 100 / Shared::totalMem));
+			while (cmp_greater(mem.percent.at(stat_names[stat]).size(), width * 2))
+				mem.percent.at(stat_names[stat]).pop_front();
 		}
 
 		if (show_disks) {
@@ -785,9 +785,9 @@ namespace Mem {
 				mem.disks_order.push_back("swap");
 				if (not disks.contains("swap"))
 					disks["swap"] = {"", "swap"};
-				disks.at("swap").total = mem.stats.at("swap_total");
-				disks.at("swap").used = mem.stats.at("swap_used");
-				disks.at("swap").free = mem.stats.at("swap_free");
+				disks.at("swap").total = mem.stats[SWAP_TOTAL];
+				disks.at("swap").used = mem.stats[SWAP_USED];
+				disks.at("swap").free = mem.stats[SWAP_FREE];
 				disks.at("swap").used_percent = mem.percent.at("swap_used").back();
 				disks.at("swap").free_percent = mem.percent.at("swap_free").back();
 			}
@@ -956,6 +956,8 @@ namespace Net {
 				}
 			}
 
+			Net::update_top_talkers(Config::getI("net_top_talkers"));
+
 			timestamp = new_timestamp;
 		}
 		//? Return empty net_info struct if no interfaces was found
@@ -17,20 +17,31 @@ tab-size = 4
 */
 
 #include <cstdlib>
+#include <map>
 #include <unordered_map>
 #include <unordered_set>
 #include <fstream>
 #include <ranges>
 #include <cmath>
 #include <unistd.h>
+#include <fcntl.h>
+#include <dirent.h>
+#include <fnmatch.h>
+#include <poll.h>
 #include <numeric>
+#include <sys/stat.h>
 #include <sys/statvfs.h>
+#include <sys/sysmacros.h>
 #include <netdb.h>
 #include <ifaddrs.h>
 #include <net/if.h>
+#include <linux/netlink.h>
+#include <linux/rtnetlink.h>
 #include <arpa/inet.h> // for inet_ntop()
 #include <filesystem>
-#include <future>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
 #include <dlfcn.h>
 #include <unordered_map>
 #include <utility>
@@ -45,6 +56,7 @@ tab-size = 4
 
 #include "../btop_shared.hpp"
 #include "../btop_config.hpp"
+#include "../btop_input.hpp"
 #include "../btop_tools.hpp"
 
 using std::clamp;
@@ -57,8 +69,6 @@ using std::numeric_limits;
 using std::round;
 using std::streamsize;
 using std::vector;
-using std::future;
-using std::async;
 using std::pair;
 
 
@@ -86,6 +96,54 @@ namespace Cpu {
 	//* Get current cpu clock speed
 	string get_cpuHz();
 
+	//* Update per core frequency and thermal throttle counters in <cpu>
+	void update_core_freq(cpu_info& cpu);
+
+	//* Values of ctxt, processes, procs_running and procs_blocked from /proc/stat, used by Mem::collect_kernel()
+	array<uint64_t, 4> stat_activity{};
+	bool stat_activity_fresh{};
+
+	//* Read the ctxt, processes, procs_running and procs_blocked lines from the current position of a /proc/stat stream
+	void read_stat_activity(std::istream& in);
+
+	//* Update per cpu interrupt and softirq rates in <cpu> from /proc/interrupts and /proc/softirqs
+	void update_irqs(cpu_info& cpu);
+
+	//* Group cores by NUMA node, package or L3 cache from /sys topology
+	auto get_core_groups() -> vector<core_group>;
+
+	//* Parse a sysfs cpu list like "0-3,8-11" into cpu numbers
+	vector<int> parse_cpulist(const string& list);
+
+	//* Cores of a hybrid core type or SMT thread class, usage is added to cpu_percent as <field>
+	struct core_class {
+		string field;
+		vector<bool> member;
+		long long totals{}, idles{};
+	};
+	vector<core_class> core_classes;
+
+	//* Detect P-cores/E-cores and SMT sibling threads from /sys topology
+	auto get_core_classes() -> vector<core_class>;
+
+	//* RAPL energy counter of a powercap zone, power draw is added to cpu_percent as <field> in percent of <max_uw> or the decaying <peak_uw>
+	struct rapl_domain {
+		string field;
+		int fd{-1};					// Kept open energy_uj
+		uint64_t range_uj{};		// Counter wraps around at max_energy_range_uj
+		uint64_t last_uj{};
+		uint64_t max_uw{};			// Highest power limit of the zone, 0 if the zone has none
+		double peak_uw{};			// Decaying peak of power seen, used as scale when <max_uw> is 0
+	};
+	vector<rapl_domain> rapl_domains;
+	uint64_t rapl_last_us{};
+
+	//* Find RAPL zones with a readable energy counter under powercap sysfs directory <root>
+	auto get_rapl_domains(const fs::path& root = "/sys/class/powercap") -> vector<rapl_domain>;
+
+	//* Update power draw of RAPL domains in <cpu>
+	void update_rapl(cpu_info& cpu);
+
 	//* Search /proc/cpuinfo for a cpu name
 	string get_cpuName();
 
@@ -258,6 +316,12 @@ namespace Shared {
 		Cpu::current_cpu.temp.insert(Cpu::current_cpu.temp.begin(), Shared::coreCount + 1, {});
 		Cpu::core_old_totals.insert(Cpu::core_old_totals.begin(), Shared::coreCount, 0);
 		Cpu::core_old_idles.insert(Cpu::core_old_idles.begin(), Shared::coreCount, 0);
+		Cpu::core_classes = Cpu::get_core_classes();
+		for (const auto& core_class : Cpu::core_classes)
+			Cpu::current_cpu.cpu_percent[core_class.field] = {};
+		Cpu::rapl_domains = Cpu::get_rapl_domains();
+		for (const auto& domain : Cpu::rapl_domains)
+			Cpu::current_cpu.cpu_percent[domain.field] = {};
 		Cpu::collect();
 		if (Runner::coreNum_reset) Runner::coreNum_reset = false;
 		for (auto& [field, vec] : Cpu::current_cpu.cpu_percent) {
@@ -269,6 +333,7 @@ namespace Shared {
 			Cpu::available_sensors.push_back(sensor);
 		}
 		Cpu::core_mapping = Cpu::get_core_mapping();
+		Cpu::core_groups = Cpu::get_core_groups();
 
 		//? Init for namespace Gpu
 	#ifdef GPU_SUPPORT
@@ -606,6 +671,386 @@ namespace Cpu {
 		return cpuhz;
 	}
 
+	//* Kept open sysfs files for per core frequency and throttle counters, sysfs attributes are regenerated on every pread at offset 0
+	struct core_freq_file {
+		int freq_fd = -1;
+		int throttle_fd = -1;
+		long long max_freq{};
+		long long last_throttle = -1;
+	};
+	vector<core_freq_file> core_freq_files;
+
+	//? Read an integer from the start of an open sysfs file, returns -1 on failure
+	long long pread_ll(int fd) {
+		if (fd < 0) return -1;
+		char buf[32];
+		const ssize_t len = pread(fd, buf, sizeof(buf) - 1, 0);
+		if (len <= 0) return -1;
+		buf[len] = '\0';
+		char* end;
+		const long long val = std::strtoll(buf, &end, 10);
+		return (end == buf ? -1 : val);
+	}
+
+	void update_core_freq(cpu_info& cpu) {
+		const size_t cores = cpu.core_percent.size();
+
+		//? Open files for any cores not seen before, missing files are only probed once
+		if (core_freq_files.size() < cores) {
+			const fs::path cpu_dir = "/sys/devices/system/cpu";
+			for (size_t i = core_freq_files.size(); i < cores; i++) {
+				const auto core_dir = cpu_dir / ("cpu" + to_string(i));
+				auto& file = core_freq_files.emplace_back();
+				file.freq_fd = open((core_dir / "cpufreq/scaling_cur_freq").c_str(), O_RDONLY | O_CLOEXEC);
+				file.throttle_fd = open((core_dir / "thermal_throttle/core_throttle_count").c_str(), O_RDONLY | O_CLOEXEC);
+				try { file.max_freq = stoll(readfile(core_dir / "cpufreq/cpuinfo_max_freq", "0")) / 1000; }
+				catch (...) { file.max_freq = 0; }
+			}
+			cpu.core_freq.resize(cores, 0);
+			cpu.core_freq_max.resize(cores, 0);
+			cpu.core_throttle.resize(cores, 0);
+			for (size_t i = 0; i < cores; i++) cpu.core_freq_max[i] = core_freq_files[i].max_freq;
+		}
+
+		for (size_t i = 0; i < cores; i++) {
+			auto& file = core_freq_files[i];
+			const long long khz = pread_ll(file.freq_fd);
+			cpu.core_freq[i] = (khz > 0 ? khz / 1000 : 0);
+
+			const long long throttles = pread_ll(file.throttle_fd);
+			cpu.core_throttle[i] = (throttles >= 0 and file.last_throttle >= 0 ? max(0ll, throttles - file.last_throttle) : 0);
+			file.last_throttle = throttles;
+		}
+	}
+
+	//? Counters from the previous read, indexed the same way as cpu_info::irqs
+	vector<vector<uint64_t>> irq_old_counts;
+	uint64_t irq_old_time{};
+
+	//? Parse one /proc/interrupts or /proc/softirqs table from <buf> into <cpu>.irqs starting at <index>
+	size_t parse_irq_table(cpu_info& cpu, const string& buf, size_t index, bool softirq, uint64_t elapsed) {
+		const char* p = buf.data();
+		const char* const end = p + buf.size();
+
+		//? Header line holds one "CPUn" column per online cpu
+		size_t ncpu = 0;
+		for (; p < end and *p != '\n'; p++) {
+			if (*p == 'C' and end - p > 3 and p[1] == 'P' and p[2] == 'U') ncpu++;
+		}
+		if (p < end) p++;
+		if (ncpu == 0) return index;
+
+		while (p < end) {
+			//? Name ends at ':', leading spaces are skipped
+			while (p < end and *p == ' ') p++;
+			const char* name_start = p;
+			while (p < end and *p != ':' and *p != '\n') p++;
+			if (p >= end or *p == '\n') { if (p < end) p++; continue; }
+			const std::string_view name{name_start, static_cast<size_t>(p - name_start)};
+			p++;
+
+			if (cpu.irqs.size() <= index) {
+				cpu.irqs.emplace_back();
+				irq_old_counts.emplace_back();
+			}
+			auto& irq = cpu.irqs[index];
+			auto& old = irq_old_counts[index];
+			const bool reset = (irq.name != name or irq.softirq != softirq or old.size() != ncpu);
+			if (reset) {
+				irq.name = name;
+				irq.softirq = softirq;
+				old.assign(ncpu, 0);
+			}
+			irq.rates.resize(ncpu);
+			irq.total = 0;
+
+			//? Fixed width counter columns, lines like "ERR:" or "MIS:" only have one
+			size_t i = 0;
+			for (; i < ncpu; i++) {
+				while (p < end and *p == ' ') p++;
+				if (p >= end or *p < '0' or *p > '9') break;
+				uint64_t count = 0;
+				for (; p < end and *p >= '0' and *p <= '9'; p++) count = count * 10 + static_cast<uint64_t>(*p - '0');
+				const long long rate = (reset or count < old[i] or elapsed == 0 ? 0 : static_cast<long long>((count - old[i]) * 1000 / elapsed));
+				old[i] = count;
+				irq.rates[i] = rate;
+				irq.total += rate;
+			}
+			for (; i < ncpu; i++) irq.rates[i] = 0;
+
+			//? Rest of the line is the chip, hwirq and action names
+			while (p < end and *p == ' ') p++;
+			const char* desc_start = p;
+			while (p < end and *p != '\n') p++;
+			if (static_cast<size_t>(p - desc_start) != irq.desc.size() or irq.desc.compare(0, irq.desc.size(), desc_start, p - desc_start) != 0)
+				irq.desc.assign(desc_start, p - desc_start);
+			if (p < end) p++;
+			index++;
+		}
+		return index;
+	}
+
+	void update_irqs(cpu_info& cpu) {
+		static string buf;
+		const uint64_t now = time_ms();
+		const uint64_t elapsed = (irq_old_time > 0 ? now - irq_old_time : 0);
+		irq_old_time = now;
+
+		size_t count = 0;
+		if (read_all(Shared::procPath / "interrupts", buf))
+			count = parse_irq_table(cpu, buf, 0, false, elapsed);
+		const size_t hard_count = count;
+		if (read_all(Shared::procPath / "softirqs", buf))
+			count = parse_irq_table(cpu, buf, count, true, elapsed);
+
+		if (cpu.irqs.size() > count) {
+			cpu.irqs.resize(count);
+			irq_old_counts.resize(count);
+		}
+
+		const size_t ncpu = cpu.core_percent.size();
+		cpu.irq_cpu_total.assign(ncpu, 0);
+		for (size_t n = 0; n < hard_count; n++) {
+			const auto& irq = cpu.irqs[n];
+			for (size_t i = 0; i < ncpu and i < irq.rates.size(); i++) cpu.irq_cpu_total[i] += irq.rates[i];
+		}
+
+		cpu.irq_order.resize(count);
+		std::iota(cpu.irq_order.begin(), cpu.irq_order.end(), 0);
+		rng::stable_sort(cpu.irq_order, [&](size_t a, size_t b) { return cpu.irqs[a].total > cpu.irqs[b].total; });
+	}
+
+	void read_stat_activity(std::istream& in) {
+		static const array activity_names { "ctxt"s, "processes"s, "procs_running"s, "procs_blocked"s };
+		for (string label; in >> label;) {
+			if (const auto it = rng::find(activity_names, label); it != activity_names.end())
+				in >> stat_activity[it - activity_names.begin()];
+			in.ignore(SSmax, '\n');
+		}
+		stat_activity_fresh = true;
+	}
+
+	vector<int> parse_cpulist(const string& list) {
+		vector<int> cpus;
+		for (const auto& range : ssplit(list, ',')) {
+			try {
+				const auto dash = range.find('-');
+				const int first = stoi(range.substr(0, dash));
+				const int last = (dash == string::npos ? first : stoi(range.substr(dash + 1)));
+				for (int i = first; i <= last; i++) cpus.push_back(i);
+			}
+			catch (...) {}
+		}
+		return cpus;
+	}
+
+	auto get_core_classes() -> vector<core_class> {
+		vector<core_class> classes;
+		const fs::path cpu_dir = "/sys/devices/system/cpu";
+		if (not fs::exists(cpu_dir)) return classes;
+
+		const auto add_class = [&](const string& field, const vector<int>& cores) {
+			core_class new_class{field, vector<bool>(Shared::coreCount, false)};
+			for (const int core : cores)
+				if (core >= 0 and core < Shared::coreCount) new_class.member[core] = true;
+			if (rng::find(new_class.member, true) != new_class.member.end())
+				classes.push_back(std::move(new_class));
+		};
+
+		try {
+			//? Hybrid core types, from cpu/types (intel_core_N/intel_atom_N), perf pmu cpu lists or differing cpu_capacity
+			vector<int> p_cores, e_cores;
+			if (fs::exists(cpu_dir / "types")) {
+				for (const auto& d : fs::directory_iterator(cpu_dir / "types")) {
+					const string type = d.path().filename();
+					auto& cores = (s_contains(type, "atom") ? e_cores : p_cores);
+					for (const int core : parse_cpulist(readfile(d.path() / "cpulist"))) cores.push_back(core);
+				}
+			}
+			if ((p_cores.empty() or e_cores.empty()) and fs::exists("/sys/devices/cpu_core/cpus") and fs::exists("/sys/devices/cpu_atom/cpus")) {
+				p_cores = parse_cpulist(readfile("/sys/devices/cpu_core/cpus"));
+				e_cores = parse_cpulist(readfile("/sys/devices/cpu_atom/cpus"));
+			}
+			if ((p_cores.empty() or e_cores.empty()) and fs::exists(cpu_dir / "cpu0/cpu_capacity")) {
+				p_cores.clear();
+				e_cores.clear();
+				vector<long long> capacity(Shared::coreCount, 0);
+				for (int i = 0; i < Shared::coreCount; i++)
+					capacity[i] = stoll(readfile(cpu_dir / ("cpu" + to_string(i)) / "cpu_capacity", "0"));
+				const long long max_capacity = rng::max(capacity);
+				for (int i = 0; i < Shared::coreCount; i++)
+					(capacity[i] == max_capacity ? p_cores : e_cores).push_back(i);
+			}
+			if (not p_cores.empty() and not e_cores.empty()) {
+				add_class("pcores", p_cores);
+				add_class("ecores", e_cores);
+			}
+
+			//? SMT, first thread in thread_siblings_list counts as the physical core and the rest as siblings
+			vector<int> physical, smt;
+			for (int i = 0; i < Shared::coreCount; i++) {
+				const auto siblings = parse_cpulist(readfile(cpu_dir / ("cpu" + to_string(i)) / "topology/thread_siblings_list"));
+				(siblings.empty() or siblings.front() == i ? physical : smt).push_back(i);
+			}
+			if (not smt.empty()) {
+				add_class("physical", physical);
+				add_class("smt", smt);
+			}
+		}
+		catch (const std::exception& e) {
+			Logger::debug("Cpu::get_core_classes() : " + string{e.what()});
+			classes.clear();
+		}
+
+		return classes;
+	}
+
+	auto get_rapl_domains(const fs::path& root) -> vector<rapl_domain> {
+		vector<rapl_domain> domains;
+		if (not fs::exists(root)) return domains;
+
+		try {
+			//? Control types without a counter of their own are skipped, "intel-rapl" is also used by the amd msr driver
+			vector<fs::path> zones;
+			for (const auto& d : fs::directory_iterator(root)) {
+				if (fs::exists(d.path() / "energy_uj")) zones.push_back(d.path());
+			}
+			//? Sorted so packages come before their subzones and msr zones before the mmio zones duplicating them
+			rng::sort(zones, [](const fs::path& a, const fs::path& b) {
+				const bool a_mmio = a.filename().string().starts_with("intel-rapl-mmio"), b_mmio = b.filename().string().starts_with("intel-rapl-mmio");
+				return (a_mmio != b_mmio ? b_mmio : a < b);
+			});
+
+			for (const auto& zone : zones) {
+				const string name = readfile(zone / "name");
+				if (name.empty()) continue;
+				const string zone_id = zone.filename();
+				string field = "pwr-" + name;
+				if (rng::any_of(domains, [&](const rapl_domain& d) { return d.field == field; })) {
+					if (zone_id.starts_with("intel-rapl-mmio")) continue;
+					//? Subzones of other packages, "intel-rapl:1:0" with name "core" becomes "pwr-core-1"
+					const auto ids = ssplit(zone_id, ':');
+					field += '-' + (ids.size() > 1 ? ids[1] : zone_id);
+				}
+
+				//? Errors are caught per zone so one unreadable or malformed zone doesn't drop the others
+				try {
+					rapl_domain domain{field};
+					domain.range_uj = stoull(readfile(zone / "max_energy_range_uj", "0"));
+					for (int c = 0; fs::exists(zone / ("constraint_" + to_string(c) + "_power_limit_uw")); c++) {
+						const string constraint = "constraint_" + to_string(c);
+						domain.max_uw = max<uint64_t>({domain.max_uw, stoull(readfile(zone / (constraint + "_power_limit_uw"), "0")),
+											stoull(readfile(zone / (constraint + "_max_power_uw"), "0"))});
+					}
+
+					//? energy_uj is only readable by root on most kernels
+					domain.fd = open((zone / "energy_uj").c_str(), O_RDONLY | O_CLOEXEC);
+					if (domain.fd < 0) {
+						Logger::debug("Cpu::get_rapl_domains() : Could not open " + (zone / "energy_uj").string() + " : " + strerror(errno));
+						continue;
+					}
+					domains.push_back(std::move(domain));
+				}
+				catch (const std::exception& e) {
+					Logger::debug("Cpu::get_rapl_domains() : " + zone.string() + " : " + string{e.what()});
+				}
+			}
+		}
+		catch (const std::exception& e) {
+			Logger::debug("Cpu::get_rapl_domains() : " + string{e.what()});
+			for (const auto& domain : domains) close(domain.fd);
+			domains.clear();
+		}
+
+		return domains;
+	}
+
+	void update_rapl(cpu_info& cpu) {
+		const uint64_t now = time_micros();
+		const uint64_t elapsed = now - rapl_last_us;
+		const bool first = (rapl_last_us == 0);
+		rapl_last_us = now;
+
+		array<char, 32> buf;
+		for (auto& domain : rapl_domains) {
+			const ssize_t len = pread(domain.fd, buf.data(), buf.size() - 1, 0);
+			if (len <= 0) continue;
+			buf[len] = '\0';
+			const uint64_t energy = strtoull(buf.data(), nullptr, 10);
+			const bool wrapped = (energy < domain.last_uj);
+			const uint64_t delta = (wrapped ? domain.range_uj - domain.last_uj + energy : energy - domain.last_uj);
+			domain.last_uj = energy;
+			auto& percent = cpu.cpu_percent.at(domain.field);
+
+			//? Without max_energy_range_uj the size of a wrap is unknown, repeat the last value instead of a bogus spike
+			if (wrapped and domain.range_uj == 0) {
+				percent.push_back(percent.empty() ? 0 : percent.back());
+				while (cmp_greater(percent.size(), width * 2)) percent.pop_front();
+				continue;
+			}
+
+			//? uJ per us is W, zones without a power limit scale to a peak that decays so a single outlier doesn't flatten the graph for good
+			const double watts = (first or elapsed == 0 ? 0.0 : (double)delta / elapsed);
+			domain.peak_uw = max(domain.peak_uw * 0.98, watts * 1'000'000);
+			const double scale_uw = (domain.max_uw > 0 ? (double)domain.max_uw : domain.peak_uw);
+			cpu.power_watts[domain.field] = watts;
+			percent.push_back(clamp((long long)round(watts * 100'000'000 / max(scale_uw, 1.0)), 0ll, 100ll));
+			while (cmp_greater(percent.size(), width * 2)) percent.pop_front();
+		}
+	}
+
+	auto get_core_groups() -> vector<core_group> {
+		vector<core_group> groups;
+		const fs::path cpu_dir = "/sys/devices/system/cpu";
+		if (not fs::exists(cpu_dir)) return groups;
+
+		//? Prefer NUMA nodes, fall back to physical packages and then to cores sharing a L3 cache (AMD CCX/CCD)
+		const auto group_by = [&](const string& prefix, auto&& get_id) {
+			std::map<int, vector<int>> ids;
+			for (int i = 0; i < Shared::coreCount; i++) {
+				const int id = get_id(i);
+				if (id < 0) return;
+				ids[id].push_back(i);
+			}
+			if (ids.size() < 2) return;
+			for (auto& [id, cores] : ids)
+				groups.push_back({prefix + to_string(id), std::move(cores)});
+		};
+
+		if (fs::exists("/sys/devices/system/node")) {
+			vector<int> core_node(Shared::coreCount, -1);
+			try {
+				for (const auto& d : fs::directory_iterator("/sys/devices/system/node")) {
+					const string dir_name = d.path().filename();
+					if (not dir_name.starts_with("node") or not isint(dir_name.substr(4))) continue;
+					const int node = stoi(dir_name.substr(4));
+					for (const int core : parse_cpulist(readfile(d.path() / "cpulist")))
+						if (core >= 0 and core < Shared::coreCount) core_node[core] = node;
+				}
+			}
+			catch (const std::exception& e) {
+				Logger::debug("Cpu::get_core_groups() : " + string{e.what()});
+			}
+			group_by("N", [&](int core) { return core_node[core]; });
+		}
+
+		if (groups.empty()) {
+			group_by("S", [&](int core) {
+				try { return stoi(readfile(cpu_dir / ("cpu" + to_string(core)) / "topology/physical_package_id", "-1")); }
+				catch (...) { return -1; }
+			});
+		}
+
+		if (groups.empty()) {
+			group_by("L3:", [&](int core) {
+				try { return stoi(readfile(cpu_dir / ("cpu" + to_string(core)) / "cache/index3/id", "-1")); }
+				catch (...) { return -1; }
+			});
+		}
+
+		return groups;
+	}
+
 	auto get_core_mapping() -> std::unordered_map<int, int> {
 		std::unordered_map<int, int> core_map;
 		if (cpu_temp_only) return core_map;
@@ -867,6 +1312,9 @@ namespace Cpu {
 
 		ifstream cread;
 
+		for (auto& core_class : core_classes)
+			core_class.totals = core_class.idles = 0;
+
 		try {
 			//? Get cpu total times for all cores from /proc/stat
 			string cpu_name;
@@ -962,6 +1410,14 @@ namespace Cpu {
 						core_old_totals.at(i-1) = totals;
 						core_old_idles.at(i-1) = idles;
 
+						//? Add to totals of hybrid core type and SMT classes
+						for (auto& core_class : core_classes) {
+							if (cmp_less(i-1, core_class.member.size()) and core_class.member[i-1]) {
+								core_class.totals += calc_totals;
+								core_class.idles += calc_idles;
+							}
+						}
+
 						cpu.core_percent.at(i-1).push_back(clamp((long long)round((double)(calc_totals - calc_idles) * 100 / calc_totals), 0ll, 100ll));
 					}
 				}
@@ -970,6 +1426,30 @@ namespace Cpu {
 				if (cpu.core_percent.at(i-1).size() > 40) cpu.core_percent.at(i-1).pop_front();
 			}
 
+			//? Context switches, forks and task counts follow the cpu and intr lines, only read when shown in the mem box
+			if (Config::getB("show_disks") and Config::getS("mem_panel") == "kernel") {
+				read_stat_activity(cread);
+			}
+
+			//? Usage of hybrid core type and SMT classes
+			for (const auto& core_class : core_classes) {
+				auto& percent = cpu.cpu_percent.at(core_class.field);
+				percent.push_back(clamp((long long)round((double)(core_class.totals - core_class.idles) * 100 / max(1ll, core_class.totals)), 0ll, 100ll));
+				while (cmp_greater(percent.size(), width * 2)) percent.pop_front();
+			}
+
+			//? Package, core and dram power draw from RAPL energy counters
+			if (not rapl_domains.empty()) update_rapl(cpu);
+
+			//? Average usage of each core group from the per core values just collected
+			cpu.group_percent.resize(core_groups.size());
+			for (size_t g = 0; g < core_groups.size(); g++) {
+				long long sum{};
+				for (const int core : core_groups[g].cores)
+					if (cmp_less(core, cpu.core_percent.size()) and not cpu.core_percent[core].empty()) sum += cpu.core_percent[core].back();
+				cpu.group_percent[g] = sum / max(1, (int)core_groups[g].cores.size());
+			}
+
 			//? Notify main thread to redraw screen if we found more cores than previously detected
 			if (cmp_greater(cpu.core_percent.size(), Shared::coreCount)) {
 				Logger::debug("Changing CPU max corecount from " + to_string(Shared::coreCount) + " to " + to_string(cpu.core_percent.size()) + ".");
@@ -988,6 +1468,12 @@ namespace Cpu {
 		if (Config::getB("check_temp") and got_sensors)
 			update_sensors();
 
+		if (Config::getB("show_core_freq"))
+			update_core_freq(cpu);
+
+		if (Config::getB("cpu_irq_matrix"))
+			update_irqs(cpu);
+
 		if (Config::getB("show_battery") and has_battery)
 			current_bat = get_battery();
 
@@ -1625,10 +2111,11 @@ namespace Gpu {
 
 namespace Mem {
 	bool has_swap{};
-	vector<string> fstab;
+	std::unordered_set<string> fstab;
 	fs::file_time_type fstab_time;
 	int disk_ios{};
 	vector<string> last_found;
+	std::unordered_set<string> last_found_set;
 
 	//?* Find the filepath to the specified ZFS object's stat file
 	fs::path get_zfs_stat_file(const string& device_name, size_t dataset_name_start, bool zfs_hide_datasets);
@@ -1636,8 +2123,399 @@ namespace Mem {
 	//?* Collect total ZFS pool io stats
 	bool zfs_collect_pool_total_stats(struct disk_info &disk);
 
+	//* Get the device number of block device <dev> for matching against /proc/diskstats, 0 if not found.
+	//* Falls back to looking up the device name in sysfs and /proc/diskstats when the /dev node is missing, as in containers
+	uint64_t get_devno(const fs::path& dev);
+
+	//* Collect per NUMA node memory usage and numa_hit/numa_miss/numa_foreign rates
+	void collect_numa(mem_info& mem);
+
+	//* Collect kernel activity rates from /proc/stat, /proc/vmstat and /proc/sys/fs/file-nr
+	void collect_kernel(mem_info& mem);
+
+	//* Collect swap areas from /proc/swaps, zram mm_stat and zswap usage, <meminfo> is the current /proc/meminfo
+	void collect_swap(mem_info& mem, std::string_view meminfo);
+
+	//* Persistent worker threads running statvfs() for mounted disks, a hung mount occupies one worker
+	//* and is reported as stale instead of new threads being started for it every update
+	namespace Statvfs {
+		struct Result {
+			disk_info disk;
+			int error{-1};	// errno from statvfs(), -1 on success
+		};
+
+		constexpr size_t worker_count = 4;		// Workers not stuck in a statvfs() for longer than stale_ms
+		constexpr size_t worker_max = 64;		// Upper limit including stuck workers
+		constexpr size_t queue_max = 256;
+		constexpr uint64_t stale_ms = 5000;
+
+		std::mutex mtx;
+		std::condition_variable cv;
+		deque<pair<string, bool>> queue;					// Mountpoint and disk_free_priv
+		std::unordered_map<string, uint64_t> pending;		// Queued or running mountpoints and time queued or started
+		std::unordered_map<string, uint64_t> running;		// Mountpoints in a statvfs() call and time started
+		std::unordered_map<string, Result> results;
+		std::unordered_set<string> mounted;					// Mountpoints results are kept for, set by prune()
+		size_t started{};
+
+		void worker() {
+			while (true) {
+				pair<string, bool> job;
+				{
+					std::unique_lock lock(mtx);
+					cv.wait(lock, [] { return not queue.empty(); });
+					job = std::move(queue.front());
+					queue.pop_front();
+					pending[job.first] = running[job.first] = time_ms();
+				}
+
+				const auto& [mountpoint, free_priv] = job;
+				Result result;
+				struct statvfs vfs;
+				if (statvfs(mountpoint.c_str(), &vfs) < 0)
+					result.error = errno;
+				else {
+					auto& disk = result.disk;
+					disk.total = vfs.f_blocks * vfs.f_frsize;
+					disk.free = (free_priv ? vfs.f_bfree : vfs.f_bavail) * vfs.f_frsize;
+					disk.used = disk.total - disk.free;
+					disk.used_percent = (disk.total > 0 ? round((double)disk.used * 100 / disk.total) : 0);
+					disk.free_percent = 100 - disk.used_percent;
+				}
+
+				std::lock_guard lock(mtx);
+				if (mounted.contains(mountpoint)) results.insert_or_assign(mountpoint, std::move(result));
+				pending.erase(mountpoint);
+				running.erase(mountpoint);
+			}
+		}
+
+		//* Queue a statvfs() of <mountpoint> unless it is already queued or running, returns false if it could not be queued
+		bool request(const string& mountpoint, bool free_priv) {
+			std::lock_guard lock(mtx);
+			if (pending.contains(mountpoint)) return true;
+			if (queue.size() >= queue_max) return false;
+			//? Workers are started on first use and never stopped, they are blocked in statvfs() or waiting for work.
+			//? A worker stuck on a hung mount gives up its slot, so hung mounts can't hold up the others
+			const uint64_t now = time_ms();
+			const size_t stuck = rng::count_if(running, [now](const auto& job) { return now - job.second > stale_ms; });
+			if (started < min(worker_count + stuck, worker_max)) {
+				std::thread(worker).detach();
+				started++;
+			}
+			queue.emplace_back(mountpoint, free_priv);
+			pending[mountpoint] = time_ms();
+			cv.notify_one();
+			return true;
+		}
+
+		//* Move a finished result for <mountpoint> into <result>, returns false if none is ready
+		bool take(const string& mountpoint, Result& result) {
+			std::lock_guard lock(mtx);
+			auto it = results.find(mountpoint);
+			if (it == results.end()) return false;
+			result = std::move(it->second);
+			results.erase(it);
+			return true;
+		}
+
+		//* Drop queued jobs and results for mountpoints not in <mounts>, later results are only kept for <mounts>
+		void prune(const std::unordered_set<string>& mounts) {
+			std::lock_guard lock(mtx);
+			mounted = mounts;
+			std::erase_if(results, [](const auto& result) { return not mounted.contains(result.first); });
+			std::erase_if(queue, [](const auto& job) {
+				if (mounted.contains(job.first)) return false;
+				pending.erase(job.first);
+				return true;
+			});
+		}
+
+		//* True if <mountpoint> has been queued or running for longer than stale_ms
+		bool is_stale(const string& mountpoint) {
+			std::lock_guard lock(mtx);
+			auto it = pending.find(mountpoint);
+			return it != pending.end() and time_ms() - it->second > stale_ms;
+		}
+	}
+
 	mem_info current_mem {};
 
+	//* Labels read from /proc/meminfo and the Mem::Stat they are stored in, looked up with a perfect hash of length, first and last character
+	namespace MemInfo {
+		struct Label {
+			std::string_view name;
+			Stat stat;
+		};
+		//? Hugepagesize is only used to convert the HugePages_ page counts and is not stored
+		constexpr array<Label, 15> labels {{
+			{"MemFree", FREE}, {"MemAvailable", AVAILABLE}, {"Cached", CACHED}, {"SwapTotal", SWAP_TOTAL}, {"SwapFree", SWAP_FREE},
+			{"Dirty", DIRTY}, {"Writeback", WRITEBACK}, {"Shmem", SHMEM}, {"SReclaimable", SLAB_RECLAIMABLE}, {"SUnreclaim", SLAB_UNRECLAIMABLE},
+			{"AnonHugePages", ANON_HUGEPAGES}, {"Mlocked", MLOCKED}, {"HugePages_Total", HUGEPAGES_TOTAL}, {"HugePages_Free", HUGEPAGES_FREE},
+			{"Hugepagesize", STAT_COUNT}
+		}};
+		constexpr size_t HUGEPAGESIZE = 14;
+		constexpr size_t none = labels.size();
+
+		constexpr size_t hash(std::string_view name) {
+			return (name.size() * 2 + name.front() + name.back() * 7) % 32;
+		}
+
+		//? Slot to label index
+		constexpr auto table = [] {
+			array<size_t, 32> t{};
+			t.fill(none);
+			for (size_t i = 0; i < labels.size(); i++) t[hash(labels[i].name)] = i;
+			return t;
+		}();
+
+		constexpr bool collision_free = [] {
+			for (size_t i = 0; i < labels.size(); i++) if (table[hash(labels[i].name)] != i) return false;
+			return true;
+		}();
+		static_assert(collision_free, "MemInfo::hash() must map every label to its own slot");
+
+		//* Index into labels for <name> or MemInfo::none if not a label of interest
+		constexpr size_t find(std::string_view name) {
+			if (name.empty()) return none;
+			const size_t i = table[hash(name)];
+			return (i < none and labels[i].name == name ? i : none);
+		}
+	}
+
+	//* Numbers of NUMA nodes from /sys/devices/system/node, empty if not supported
+	const vector<int>& get_numa_nodes() {
+		static vector<int> nodes;
+		static bool scanned{};
+		if (not scanned) {
+			scanned = true;
+			try {
+				if (fs::exists("/sys/devices/system/node")) {
+					for (const auto& d : fs::directory_iterator("/sys/devices/system/node")) {
+						const string dir_name = d.path().filename();
+						if (dir_name.starts_with("node") and isint(dir_name.substr(4)))
+							nodes.push_back(stoi(dir_name.substr(4)));
+					}
+				}
+			}
+			catch (const std::exception& e) {
+				Logger::debug("Mem::get_numa_nodes() : " + string{e.what()});
+				nodes.clear();
+			}
+			rng::sort(nodes);
+		}
+		return nodes;
+	}
+
+	//* NUMA node for each cpu number, -1 for unknown
+	const vector<int>& get_cpu_nodes() {
+		static vector<int> cpu_nodes;
+		static bool scanned{};
+		if (not scanned) {
+			scanned = true;
+			for (const int node : get_numa_nodes()) {
+				for (const int cpu : Cpu::parse_cpulist(readfile("/sys/devices/system/node/node" + to_string(node) + "/cpulist"))) {
+					if (cpu < 0) continue;
+					if (cpu_nodes.size() <= (size_t)cpu) cpu_nodes.resize(cpu + 1, -1);
+					cpu_nodes[cpu] = node;
+				}
+			}
+		}
+		return cpu_nodes;
+	}
+
+	void collect_numa(mem_info& mem) {
+		static uint64_t last_time{};
+		const auto& nodes = get_numa_nodes();
+		const uint64_t now = time_ms();
+		const double seconds = max(0.001, (double)(now - last_time) / 1000);
+		const bool first_run = (mem.numa.size() != nodes.size());
+		if (first_run) {
+			mem.numa.clear();
+			for (const int node : nodes) mem.numa.push_back({node});
+		}
+
+		ifstream nread;
+		for (auto& numa : mem.numa) {
+			const fs::path node_dir = "/sys/devices/system/node/node" + to_string(numa.node);
+
+			//? Lines are formatted as "Node 0 MemTotal:       16318164 kB"
+			nread.open(node_dir / "meminfo");
+			if (nread.good()) {
+				int got{};
+				for (string label; got < 3 and nread.ignore(SSmax, ' ') and nread.ignore(SSmax, ' ') and nread >> label;) {
+					uint64_t* target = (label == "MemTotal:" ? &numa.total : (label == "MemFree:" ? &numa.free : (label == "MemUsed:" ? &numa.used : nullptr)));
+					if (target != nullptr) {
+						nread >> *target;
+						*target <<= 10;
+						got++;
+					}
+					nread.ignore(SSmax, '\n');
+				}
+				numa.used_percent = (numa.total > 0 ? round((double)numa.used * 100 / numa.total) : 0);
+			}
+			nread.close();
+
+			//? numastat counts are in pages
+			nread.open(node_dir / "numastat");
+			if (nread.good()) {
+				array<uint64_t, 3> stat = numa.old_stat;
+				for (string label; nread >> label;) {
+					const size_t i = (label == "numa_hit" ? 0 : (label == "numa_miss" ? 1 : (label == "numa_foreign" ? 2 : 3)));
+					if (i < 3) nread >> stat[i];
+					nread.ignore(SSmax, '\n');
+				}
+				for (size_t i = 0; i < 3; i++) {
+					numa.rates[i] = (first_run or stat[i] < numa.old_stat[i] ? 0 : (stat[i] - numa.old_stat[i]) * Shared::pageSize / seconds);
+					numa.old_stat[i] = stat[i];
+				}
+			}
+			nread.close();
+		}
+		last_time = now;
+	}
+
+	void collect_kernel(mem_info& mem) {
+		static string buf;
+		static uint64_t last_time{};
+		//? Counters are ctxt, processes, pgfault, pgmajfault, pswpin, pswpout, pgscan_*, pgsteal_*, thp_*_alloc
+		static array<uint64_t, 9> old_counters{};
+		array<uint64_t, 9> counters{};
+		const uint64_t now = time_ms();
+		const uint64_t elapsed = now - last_time;
+		const bool first_run = (last_time == 0);
+
+		//? Cpu::collect() reads these while it has /proc/stat open, unless the cpu box is hidden
+		if (not Cpu::stat_activity_fresh) {
+			ifstream sread(Shared::procPath / "stat");
+			if (sread.good()) Cpu::read_stat_activity(sread);
+		}
+		Cpu::stat_activity_fresh = false;
+		counters[0] = Cpu::stat_activity[0];
+		counters[1] = Cpu::stat_activity[1];
+
+		//? Lines in /proc/vmstat are formatted as "pgfault 123456"
+		static const array<pair<std::string_view, size_t>, 12> vm_fields {{
+			{"pgfault", 2}, {"pgmajfault", 3}, {"pswpin", 4}, {"pswpout", 5},
+			{"pgscan_kswapd", 6}, {"pgscan_direct", 6}, {"pgscan_khugepaged", 6},
+			{"pgsteal_kswapd", 7}, {"pgsteal_direct", 7}, {"pgsteal_khugepaged", 7},
+			{"thp_fault_alloc", 8}, {"thp_collapse_alloc", 8}
+		}};
+		if (read_all(Shared::procPath / "vmstat", buf)) {
+			for (size_t pos = 0; pos < buf.size();) {
+				const size_t space = buf.find(' ', pos);
+				const size_t eol = buf.find('\n', pos);
+				if (space == string::npos or eol == string::npos) break;
+				if (buf[pos] == 'p' or buf[pos] == 't') {
+					const std::string_view name{buf.data() + pos, space - pos};
+					size_t idx = 0;
+					for (const auto& [field, i] : vm_fields)
+						if (field == name) { idx = i; break; }
+					if (idx > 0) {
+						uint64_t val{};
+						for (size_t p = space + 1; p < eol and buf[p] >= '0' and buf[p] <= '9'; p++) val = val * 10 + (buf[p] - '0');
+						counters[idx] += val;
+					}
+				}
+				pos = eol + 1;
+			}
+		}
+
+		auto push = [&](Kernel stat, long long value) {
+			auto& values = mem.kernel.values[stat];
+			values.push_back(value);
+			while (cmp_greater(values.size(), width * 2)) values.pop_front();
+		};
+
+		//? Rates per second for counters, current values for gauges
+		static constexpr array counter_stats { CTXT, FORKS, FAULTS, MAJFAULTS, SWAPIN, SWAPOUT, SCANNED, RECLAIMED, THP };
+		for (size_t i = 0; i < counters.size(); i++) {
+			push(counter_stats[i], (first_run or elapsed == 0 or counters[i] < old_counters[i] ? 0 : (counters[i] - old_counters[i]) * 1000 / elapsed));
+		}
+		old_counters = counters;
+		push(RUNNING, Cpu::stat_activity[2]);
+		push(BLOCKED, Cpu::stat_activity[3]);
+
+		//? /proc/sys/fs/file-nr holds allocated handles, free allocated handles and the maximum
+		if (read_all(Shared::procPath / "sys/fs/file-nr", buf)) {
+			const auto fields = ssplit(buf, '\t');
+			if (fields.size() >= 3 and isint(fields[0]) and isint(fields[1])) {
+				try {
+					push(FILES, stoll(fields[0]) - stoll(fields[1]));
+				}
+				catch (const std::exception&) {}
+			}
+		}
+
+		last_time = now;
+	}
+
+	void collect_swap(mem_info& mem, std::string_view meminfo) {
+		static string buf;
+		auto& swap = mem.swap;
+		swap.devices.clear();
+
+		//? /proc/swaps is "Filename Type Size Used Priority" after a header line, sizes in kB
+		if (read_all(Shared::procPath / "swaps", buf)) {
+			const auto lines = ssplit(buf, '\n');
+			for (auto line : lines | rng::views::drop(1)) {
+				rng::replace(line, '\t', ' ');
+				const auto fields = ssplit(line);
+				if (fields.size() < 5 or not isint(fields[2]) or not isint(fields[3])) continue;
+				auto& dev = swap.devices.emplace_back();
+				dev.name = fields[0];
+				dev.type = fields[1];
+				try {
+					dev.size = stoull(fields[2]) << 10;
+					dev.used = stoull(fields[3]) << 10;
+					dev.priority = stoi(fields[4]);
+				}
+				catch (const std::exception&) {}
+				dev.used_percent = (dev.size > 0 ? round((double)dev.used * 100 / dev.size) : 0);
+
+				//? mm_stat starts with orig_data_size, compr_data_size and mem_used_total in bytes
+				if (dev.name.starts_with("/dev/zram")) {
+					dev.zram = true;
+					if (read_all(fs::path("/sys/block") / fs::path(dev.name).filename() / "mm_stat", buf)) {
+						const auto stats = ssplit(buf);
+						if (stats.size() >= 3 and isint(stats[0]) and isint(stats[1]) and isint(stats[2])) {
+							dev.orig = stoull(stats[0]);
+							dev.compr = stoull(stats[1]);
+							dev.mem_used = stoull(stats[2]);
+						}
+					}
+				}
+			}
+		}
+
+		//? Zswap and Zswapped are in meminfo since Linux 5.19, older kernels only have them in debugfs
+		swap.zswap_pool = swap.zswapped = 0;
+		bool got_zswap{};
+		for (const auto& [name, value] : {pair{"\nZswap:"sv, &swap.zswap_pool}, pair{"\nZswapped:"sv, &swap.zswapped}}) {
+			if (const size_t pos = meminfo.find(name); pos != std::string_view::npos) {
+				size_t p = pos + name.size();
+				while (p < meminfo.size() and meminfo[p] == ' ') p++;
+				for (; p < meminfo.size() and meminfo[p] >= '0' and meminfo[p] <= '9'; p++) *value = *value * 10 + (meminfo[p] - '0');
+				*value <<= 10;
+				got_zswap = true;
+			}
+		}
+		if (not got_zswap and access("/sys/kernel/debug/zswap", R_OK) == 0) {
+			if (read_all("/sys/kernel/debug/zswap/pool_total_size", buf) and isint(trim(buf, "\n")))
+				swap.zswap_pool = stoull(buf);
+			if (read_all("/sys/kernel/debug/zswap/stored_pages", buf) and isint(trim(buf, "\n")))
+				swap.zswapped = stoull(buf) * Shared::pageSize;
+		}
+
+		uint64_t orig = swap.zswapped, compr = swap.zswap_pool;
+		for (const auto& dev : swap.devices) {
+			orig += dev.orig;
+			compr += dev.compr;
+		}
+		swap.ratio.push_back(compr > 0 ? round((double)orig * 100 / compr) : 0);
+		while (cmp_greater(swap.ratio.size(), width * 2)) swap.ratio.pop_front();
+	}
+
 	uint64_t get_totalMem() {
 		ifstream meminfo(Shared::procPath / "meminfo");
 		int64_t totalMem;
@@ -1661,8 +2539,6 @@ namespace Mem {
 		auto totalMem = get_totalMem();
 		auto& mem = current_mem;
 
-		mem.stats.at("swap_total") = 0;
-
 		//? Read ZFS ARC info from /proc/spl/kstat/zfs/arcstats
 		uint64_t arc_size = 0, arc_min_size = 0;
 		if (zfs_arc_cached) {
@@ -1681,71 +2557,114 @@ namespace Mem {
 			arcstats.close();
 		}
 
-		//? Read memory info from /proc/meminfo
-		ifstream meminfo(Shared::procPath / "meminfo");
-		if (meminfo.good()) {
-			bool got_avail = false;
-			for (string label; meminfo.peek() != 'D' and meminfo >> label;) {
-				if (label == "MemFree:") {
-					meminfo >> mem.stats.at("free");
-					mem.stats.at("free") <<= 10;
-				}
-				else if (label == "MemAvailable:") {
-					meminfo >> mem.stats.at("available");
-					mem.stats.at("available") <<= 10;
-					got_avail = true;
-				}
-				else if (label == "Cached:") {
-					meminfo >> mem.stats.at("cached");
-					mem.stats.at("cached") <<= 10;
-					if (not show_swap and not swap_disk) break;
-				}
-				else if (label == "SwapTotal:") {
-					meminfo >> mem.stats.at("swap_total");
-					mem.stats.at("swap_total") <<= 10;
-				}
-				else if (label == "SwapFree:") {
-					meminfo >> mem.stats.at("swap_free");
-					mem.stats.at("swap_free") <<= 10;
-					break;
+		//? Read all of /proc/meminfo in one pass, values are in kB except for the HugePages_ page counts
+		static string buf;
+		if (not read_all(Shared::procPath / "meminfo", buf))
+			throw std::runtime_error("Failed to read /proc/meminfo");
+
+		array<uint64_t, MemInfo::labels.size()> values{};
+		bool got_avail{};
+		for (size_t pos = 0; pos < buf.size();) {
+			const size_t colon = buf.find(':', pos);
+			size_t eol = buf.find('\n', pos);
+			if (eol == string::npos) eol = buf.size();
+			if (colon < eol) {
+				if (const size_t i = MemInfo::find({buf.data() + pos, colon - pos}); i != MemInfo::none) {
+					size_t p = colon + 1;
+					while (p < eol and buf[p] == ' ') p++;
+					uint64_t val{};
+					for (; p < eol and buf[p] >= '0' and buf[p] <= '9'; p++) val = val * 10 + (buf[p] - '0');
+					values[i] = val;
+					if (MemInfo::labels[i].stat == AVAILABLE) got_avail = true;
 				}
-				meminfo.ignore(SSmax, '\n');
-			}
-			if (not got_avail) mem.stats.at("available") = mem.stats.at("free") + mem.stats.at("cached");
-			if (zfs_arc_cached) {
-				mem.stats.at("cached") += arc_size;
-				// The ARC will not shrink below arc_min_size, so that memory is not available
-				if (arc_size > arc_min_size)
-					mem.stats.at("available") += arc_size - arc_min_size;
 			}
-			mem.stats.at("used") = totalMem - (mem.stats.at("available") <= totalMem ? mem.stats.at("available") : mem.stats.at("free"));
+			pos = eol + 1;
+		}
 
-			if (mem.stats.at("swap_total") > 0) mem.stats.at("swap_used") = mem.stats.at("swap_total") - mem.stats.at("swap_free");
+		const uint64_t hugepage_size = values[MemInfo::HUGEPAGESIZE] << 10;
+		for (size_t i = 0; i < MemInfo::labels.size(); i++) {
+			const auto stat = MemInfo::labels[i].stat;
+			if (stat == STAT_COUNT) continue;
+			mem.stats[stat] = (stat == HUGEPAGES_TOTAL or stat == HUGEPAGES_FREE ? values[i] * hugepage_size : values[i] << 10);
 		}
-		else
-			throw std::runtime_error("Failed to read /proc/meminfo");
+		if (not got_avail) mem.stats[AVAILABLE] = mem.stats[FREE] + mem.stats[CACHED];
 
-		meminfo.close();
+		if (zfs_arc_cached) {
+			mem.stats[CACHED] += arc_size;
+			// The ARC will not shrink below arc_min_size, so that memory is not available
+			if (arc_size > arc_min_size)
+				mem.stats[AVAILABLE] += arc_size - arc_min_size;
+		}
+		mem.stats[USED] = totalMem - (mem.stats[AVAILABLE] <= totalMem ? mem.stats[AVAILABLE] : mem.stats[FREE]);
+		mem.stats[SWAP_USED] = (mem.stats[SWAP_TOTAL] > mem.stats[SWAP_FREE] ? mem.stats[SWAP_TOTAL] - mem.stats[SWAP_FREE] : 0);
 
 		//? Calculate percentages
-		for (const auto& name : mem_names) {
-			mem.percent.at(name).push_back(round((double)mem.stats.at(name) * 100 / totalMem));
-			while (cmp_greater(mem.percent.at(name).size(), width * 2)) mem.percent.at(name).pop_front();
+		for (const auto& stat : mem_names) {
+			auto& percent = mem.percent.at(stat_names[stat]);
+			percent.push_back(round((double)mem.stats[stat] * 100 / totalMem));
+			while (cmp_greater(percent.size(), width * 2)) percent.pop_front();
+		}
+
+		//? Extra values are only kept for the ones selected in mem_extra_stats, parsed again when the option changes.
+		//? Draw::calcSizes() sizes the box from the option as well and may have seen an older value while the config was locked
+		static string extra_config;
+		static bool extra_parsed{};
+		if (const auto& config = Config::getS("mem_extra_stats"); not extra_parsed or config != extra_config) {
+			if (extra_parsed) {
+				Global::resized = true;
+				Input::interrupt();
+			}
+			extra_parsed = true;
+			extra_config = config;
+			const auto selected = ssplit(extra_config);
+			mem.extra_stats.clear();
+			for (const auto& stat : extra_names) {
+				if (v_contains(selected, stat_names[stat])) mem.extra_stats.push_back(stat);
+				else mem.percent.erase(stat_names[stat]);
+			}
+		}
+		for (const auto& stat : mem.extra_stats) {
+			auto& percent = mem.percent[stat_names[stat]];
+			percent.push_back(round((double)mem.stats[stat] * 100 / totalMem));
+			while (cmp_greater(percent.size(), width * 2)) percent.pop_front();
 		}
 
-		if (show_swap and mem.stats.at("swap_total") > 0) {
-			for (const auto& name : swap_names) {
-				mem.percent.at(name).push_back(round((double)mem.stats.at(name) * 100 / mem.stats.at("swap_total")));
-				while (cmp_greater(mem.percent.at(name).size(), width * 2)) mem.percent.at(name).pop_front();
+		if (show_swap and mem.stats[SWAP_TOTAL] > 0) {
+			for (const auto& stat : swap_names) {
+				auto& percent = mem.percent.at(stat_names[stat]);
+				percent.push_back(round((double)mem.stats[stat] * 100 / mem.stats[SWAP_TOTAL]));
+				while (cmp_greater(percent.size(), width * 2)) percent.pop_front();
 			}
 			has_swap = true;
 		}
 		else
 			has_swap = false;
 
+		//? Get NUMA node stats if shown
+		if (show_disks and Config::getS("mem_panel") == "numa")
+			collect_numa(mem);
+
+		//? Get kernel activity if shown
+		if (show_disks and Config::getS("mem_panel") == "kernel")
+			collect_kernel(mem);
+
+		//? Get swap areas, zram and zswap if shown
+		if (show_disks and Config::getS("mem_panel") == "swap")
+			collect_swap(mem, buf);
+
 		//? Get disks stats
 		if (show_disks) {
-			static vector<string> ignore_list;
+			static std::unordered_set<string> ignore_list;
+			static string last_settings, mounts_buf;
+			static int mounts_fd{-1};
+			static const bool mtab_is_file = fs::exists("/etc/mtab") and not fs::is_symlink("/etc/mtab");
+			//? Overlay, tmpfs and squashfs mounts collapsed into one row per filesystem type, keyed "#<fstype>"
+			static std::unordered_map<string, vector<string>> group_members;
+			static std::unordered_map<string, size_t> group_pos;
+			static std::unordered_map<string, array<int64_t, 2>> member_sizes;	// Total and free bytes per member mountpoint
+			static std::unordered_map<string, array<int64_t, 2>> group_sums;
+			static const std::unordered_set<string> group_types = {"overlay", "tmpfs", "devtmpfs", "ramfs", "squashfs"};
+			constexpr size_t group_budget = 16;
 			double uptime = system_uptime();
 			auto free_priv = Config::getB("disk_free_priv");
 			try {
@@ -1754,50 +2673,44 @@ namespace Mem {
 				auto use_fstab = Config::getB("use_fstab");
 				auto only_physical = Config::getB("only_physical");
 				auto zfs_hide_datasets = Config::getB("zfs_hide_datasets");
+				auto group_mounts = Config::getB("disks_group");
 				auto& disks = mem.disks;
-				static std::unordered_map<string, future<pair<disk_info, int>>> disks_stats_promises;
 				ifstream diskread;
 
-				vector<string> filter;
-				if (not disks_filter.empty()) {
-					filter = ssplit(disks_filter);
-					if (filter.at(0).starts_with("exclude=")) {
-						filter_exclude = true;
-						filter.at(0) = filter.at(0).substr(8);
-					}
-				}
+				//? Only parse the mount table again when it or any setting deciding what is shown has changed
+				const string settings = disks_filter + '\n' + to_string(use_fstab) + to_string(only_physical) + to_string(zfs_hide_datasets)
+									  + to_string(group_mounts) + to_string(swap_disk and has_swap);
+				bool mounts_changed = mtab_is_file or settings != last_settings;
+				last_settings = settings;
 
-				//? Get list of "real" filesystems from /proc/filesystems
-				vector<string> fstypes;
-				if (only_physical and not use_fstab) {
-					fstypes = {"zfs", "wslfs", "drvfs"};
-					diskread.open(Shared::procPath / "filesystems");
-					if (diskread.good()) {
-						for (string fstype; diskread >> fstype;) {
-							if (not is_in(fstype, "nodev", "squashfs", "nullfs"))
-								fstypes.push_back(fstype);
-							diskread.ignore(SSmax, '\n');
-						}
-					}
-					else
-						throw std::runtime_error("Failed to read /proc/filesystems");
-					diskread.close();
+				//? The kernel flags /proc/self/mounts with POLLPRI (and POLLERR) once after each change to the mount table
+				if (mounts_fd < 0) {
+					mounts_fd = open((Shared::procPath / "self/mounts").c_str(), O_RDONLY | O_CLOEXEC);
+					mounts_changed = true;
 				}
+				if (mounts_fd >= 0) {
+					struct pollfd pfd {mounts_fd, POLLPRI, 0};
+					if (poll(&pfd, 1, 0) > 0 and (pfd.revents & (POLLPRI | POLLERR)))
+						mounts_changed = true;
+				}
+				else
+					mounts_changed = true;
 
 				//? Get disk list to use from fstab if enabled
 				if (use_fstab and fs::last_write_time("/etc/fstab") != fstab_time) {
 					fstab.clear();
 					fstab_time = fs::last_write_time("/etc/fstab");
+					mounts_changed = true;
 					diskread.open("/etc/fstab");
 					if (diskread.good()) {
 						for (string instr; diskread >> instr;) {
 							if (not instr.starts_with('#')) {
 								diskread >> instr;
 								#ifdef SNAPPED
-									if (instr == "/") fstab.push_back("/mnt");
-									else if (not is_in(instr, "none", "swap")) fstab.push_back(instr);
+									if (instr == "/") fstab.insert("/mnt");
+									else if (not is_in(instr, "none", "swap")) fstab.insert(instr);
 								#else
-									if (not is_in(instr, "none", "swap")) fstab.push_back(instr);
+									if (not is_in(instr, "none", "swap")) fstab.insert(instr);
 								#endif
 							}
 							diskread.ignore(SSmax, '\n');
@@ -1808,22 +2721,63 @@ namespace Mem {
 					diskread.close();
 				}
 
-				//? Get mounts from /etc/mtab or /proc/self/mounts
-				diskread.open((fs::exists("/etc/mtab") ? fs::path("/etc/mtab") : Shared::procPath / "self/mounts"));
-				if (diskread.good()) {
+				if (mounts_changed) {
+					std::unordered_set<string> filter;
+					if (not disks_filter.empty()) {
+						auto filter_list = ssplit(disks_filter);
+						if (filter_list.at(0).starts_with("exclude=")) {
+							filter_exclude = true;
+							filter_list.at(0) = filter_list.at(0).substr(8);
+						}
+						filter.insert(filter_list.begin(), filter_list.end());
+					}
+
+					//? Get list of "real" filesystems from /proc/filesystems
+					std::unordered_set<string> fstypes;
+					if (only_physical and not use_fstab) {
+						fstypes = {"zfs", "wslfs", "drvfs"};
+						diskread.open(Shared::procPath / "filesystems");
+						if (diskread.good()) {
+							for (string fstype; diskread >> fstype;) {
+								if (not is_in(fstype, "nodev", "squashfs", "nullfs"))
+									fstypes.insert(fstype);
+								diskread.ignore(SSmax, '\n');
+							}
+						}
+						else
+							throw std::runtime_error("Failed to read /proc/filesystems");
+						diskread.close();
+					}
+
+					//? Get mounts from /etc/mtab or /proc/self/mounts
+					if (not read_all((mtab_is_file ? fs::path("/etc/mtab") : Shared::procPath / "self/mounts"), mounts_buf))
+						throw std::runtime_error("Failed to get mounts from /etc/mtab and /proc/self/mounts");
+
 					vector<string> found;
 					found.reserve(last_found.size());
-					string dev, mountpoint, fstype;
-					while (not diskread.eof()) {
+					std::unordered_set<string> found_set;
+					std::unordered_map<uint64_t, string> seen_devs;
+					std::unordered_map<string, vector<string>> new_groups;
+					std::string_view rest = mounts_buf;
+					auto next_field = [&rest]() -> string {
+						const auto end = rest.find_first_of(" \n");
+						string field{rest.substr(0, end)};
+						rest.remove_prefix(end == std::string_view::npos ? rest.size() : end + (rest[end] == ' ' ? 1 : 0));
+						return field;
+					};
+					while (not rest.empty()) {
 						std::error_code ec;
-						diskread >> dev >> mountpoint >> fstype;
-						diskread.ignore(SSmax, '\n');
+						const string dev = next_field();
+						const string mountpoint = next_field();
+						const string fstype = next_field();
+						if (const auto eol = rest.find('\n'); eol != std::string_view::npos) rest.remove_prefix(eol + 1);
+						else rest = {};
 
-						if (v_contains(ignore_list, mountpoint) or v_contains(found, mountpoint)) continue;
+						if (mountpoint.empty() or ignore_list.contains(mountpoint) or found_set.contains(mountpoint)) continue;
 
 						//? Match filter if not empty
 						if (not filter.empty()) {
-							bool match = v_contains(filter, mountpoint);
+							bool match = filter.contains(mountpoint);
 							if ((filter_exclude and match) or (not filter_exclude and not match))
 								continue;
 						}
@@ -1833,12 +2787,17 @@ namespace Mem {
 						if (fstype == "zfs" && (zfs_dataset_name_start = dev.find('/')) != std::string::npos && zfs_hide_datasets) continue;
 
 						if ((not use_fstab and not only_physical)
-						or (use_fstab and v_contains(fstab, mountpoint))
-						or (not use_fstab and only_physical and v_contains(fstypes, fstype))) {
-							found.push_back(mountpoint);
-							if (not v_contains(last_found, mountpoint)) redraw = true;
+						or (use_fstab and fstab.contains(mountpoint))
+						or (not use_fstab and only_physical and fstypes.contains(fstype))) {
+							found_set.insert(mountpoint);
 
-							//? Save mountpoint, name, fstype, dev path and path to /sys/block stat file
+							//? Container and runtime mounts only count towards their family's summary row
+							if (group_mounts and group_types.contains(fstype) and not is_in(mountpoint, "/", "/mnt")) {
+								new_groups["#" + fstype].push_back(mountpoint);
+								continue;
+							}
+
+							//? Save mountpoint, name, fstype, dev path and device number
 							if (not disks.contains(mountpoint)) {
 								disks[mountpoint] = disk_info{fs::canonical(dev, ec), fs::path(mountpoint).filename(), fstype};
 								if (disks.at(mountpoint).dev.empty()) disks.at(mountpoint).dev = dev;
@@ -1846,28 +2805,27 @@ namespace Mem {
 									if (mountpoint == "/mnt") disks.at(mountpoint).name = "root";
 								#endif
 								if (disks.at(mountpoint).name.empty()) disks.at(mountpoint).name = (mountpoint == "/" ? "root" : mountpoint);
-								string devname = disks.at(mountpoint).dev.filename();
-								int c = 0;
-								while (devname.size() >= 2) {
-									if (fs::exists("/sys/block/" + devname + "/stat", ec) and access(string("/sys/block/" + devname + "/stat").c_str(), R_OK) == 0) {
-										if (c > 0 and fs::exists("/sys/block/" + devname + '/' + disks.at(mountpoint).dev.filename().string() + "/stat", ec))
-											disks.at(mountpoint).stat = "/sys/block/" + devname + '/' + disks.at(mountpoint).dev.filename().string() + "/stat";
-										else
-											disks.at(mountpoint).stat = "/sys/block/" + devname + "/stat";
-										break;
-									//? Set ZFS stat filepath
-									} else if (fstype == "zfs") {
-										disks.at(mountpoint).stat = get_zfs_stat_file(dev, zfs_dataset_name_start, zfs_hide_datasets);
-										if (disks.at(mountpoint).stat.empty()) {
-											Logger::debug("Failed to get ZFS stat file for device " + dev);
-										}
-										break;
+								//? Block devices are matched against /proc/diskstats by device number, ZFS uses kstat files
+								if (fstype == "zfs") {
+									disks.at(mountpoint).stat = get_zfs_stat_file(dev, zfs_dataset_name_start, zfs_hide_datasets);
+									if (disks.at(mountpoint).stat.empty()) {
+										Logger::debug("Failed to get ZFS stat file for device " + dev);
 									}
-									devname.resize(devname.size() - 1);
-									c++;
 								}
+								else
+									disks.at(mountpoint).devno = get_devno(disks.at(mountpoint).dev);
+							}
+
+							//? Bind mounts and subvolumes of an already listed block device report the same sizes, keep the first
+							if (group_mounts and disks.at(mountpoint).devno != 0
+							and not seen_devs.try_emplace(disks.at(mountpoint).devno, mountpoint).second) {
+								disks.erase(mountpoint);
+								continue;
 							}
 
+							found.push_back(mountpoint);
+							if (not last_found_set.contains(mountpoint)) redraw = true;
+
 							//? If zfs_hide_datasets option was switched, refresh stat filepath
 							if (fstype == "zfs" && ((zfs_hide_datasets && !is_directory(disks.at(mountpoint).stat))
 								|| (!zfs_hide_datasets && is_directory(disks.at(mountpoint).stat)))) {
@@ -1879,62 +2837,90 @@ namespace Mem {
 						}
 					}
 
+					//? Add a summary row per collapsed family and recount its sums from the cached member sizes
+					std::unordered_map<string, array<int64_t, 2>> new_sizes;
+					group_sums.clear();
+					for (auto& [key, members] : new_groups) {
+						const string fstype = key.substr(1);
+						if (not disks.contains(key)) disks[key] = disk_info{"", "", fstype};
+						disks.at(key).name = fstype + " (" + to_string(members.size()) + ")";
+						auto& sums = group_sums[key];
+						sums = {0, 0};
+						for (const auto& member : members) {
+							if (auto size = member_sizes.find(member); size != member_sizes.end()) {
+								sums[0] += size->second[0];
+								sums[1] += size->second[1];
+								new_sizes.insert(*size);
+							}
+						}
+						found.push_back(key);
+						if (not last_found_set.contains(key)) redraw = true;
+					}
+					member_sizes = std::move(new_sizes);
+					group_members = std::move(new_groups);
+
 					//? Remove disks no longer mounted or filtered out
 					if (swap_disk and has_swap) found.push_back("swap");
+					found_set.insert(found.begin(), found.end());
 					for (auto it = disks.begin(); it != disks.end();) {
-						if (not v_contains(found, it->first))
+						if (not found_set.contains(it->first))
 							it = disks.erase(it);
 						else
 							it++;
 					}
 					if (found.size() != last_found.size()) redraw = true;
 					last_found = std::move(found);
+					Statvfs::prune(found_set);
+					last_found_set = std::move(found_set);
 				}
-				else
-					throw std::runtime_error("Failed to get mounts from /etc/mtab and /proc/self/mounts");
-				diskread.close();
 
 				//? Get disk/partition stats
 				for (auto it = disks.begin(); it != disks.end(); ) {
 					auto &[mountpoint, disk] = *it;
-					if (v_contains(ignore_list, mountpoint) or disk.name == "swap") {
+					if (ignore_list.contains(mountpoint) or disk.name == "swap") {
 						it = disks.erase(it);
 						continue;
 					}
-					if(auto promises_it = disks_stats_promises.find(mountpoint); promises_it != disks_stats_promises.end()){
-						auto& promise = promises_it->second;
-						if(promise.valid() &&
-						   promise.wait_for(0s) == std::future_status::timeout) {
-							++it;
-							continue;
+					//? Summary rows refresh a few members per tick through the same pool and keep running sums
+					if (auto group = group_members.find(mountpoint); group != group_members.end()) {
+						const auto& members = group->second;
+						auto& pos = group_pos[mountpoint];
+						auto& sums = group_sums[mountpoint];
+						for (size_t n = 0; n < min(members.size(), group_budget); n++) {
+							const auto& member = members[pos++ % members.size()];
+							if (Statvfs::Result result; Statvfs::take(member, result) and result.error == -1) {
+								auto& size = member_sizes[member];
+								sums[0] += result.disk.total - size[0];
+								sums[1] += result.disk.free - size[1];
+								size = {result.disk.total, result.disk.free};
+							}
+							Statvfs::request(member, free_priv);
 						}
-						auto promise_res = promises_it->second.get();
-						if(promise_res.second != -1){
-							ignore_list.push_back(mountpoint);
-							Logger::warning("Failed to get disk/partition stats for mount \""+ mountpoint + "\" with statvfs error code: " + to_string(promise_res.second) + ". Ignoring...");
+						disk.total = sums[0];
+						disk.free = sums[1];
+						disk.used = disk.total - disk.free;
+						disk.used_percent = (disk.total > 0 ? round((double)disk.used * 100 / disk.total) : 0);
+						disk.free_percent = 100 - disk.used_percent;
+						++it;
+						continue;
+					}
+					//? Use the newest finished statvfs() and queue the next, mounts that don't answer are marked stale
+					if (Statvfs::Result result; Statvfs::take(mountpoint, result)) {
+						if (result.error != -1) {
+							ignore_list.insert(mountpoint);
+							Logger::warning("Failed to get disk/partition stats for mount \""+ mountpoint + "\" with statvfs error code: " + to_string(result.error) + ". Ignoring...");
 							it = disks.erase(it);
 							continue;
 						}
-						auto &updated_stats = promise_res.first;
-						disk.total = updated_stats.total;
-						disk.free = updated_stats.free;
-						disk.used = updated_stats.used;
-						disk.used_percent = updated_stats.used_percent;
-						disk.free_percent = updated_stats.free_percent;
-					}
-					disks_stats_promises[mountpoint] = async(std::launch::async, [mountpoint, &free_priv]() -> pair<disk_info, int> {
-						struct statvfs vfs;
-						disk_info disk;
-						if (statvfs(mountpoint.c_str(), &vfs) < 0) {
-							return pair{disk, errno};
-						}
-						disk.total = vfs.f_blocks * vfs.f_frsize;
-						disk.free = (free_priv ? vfs.f_bfree : vfs.f_bavail) * vfs.f_frsize;
-						disk.used = disk.total - disk.free;
-						disk.used_percent = round((double)disk.used * 100 / disk.total);
-						disk.free_percent = 100 - disk.used_percent;
-						return pair{disk, -1};
-					});
+						disk.total = result.disk.total;
+						disk.free = result.disk.free;
+						disk.used = result.disk.used;
+						disk.used_percent = result.disk.used_percent;
+						disk.free_percent = result.disk.free_percent;
+					}
+					//? Only mounts pending for longer than stale_ms are stale, a full queue keeps the last values and is retried next update
+					disk.stale = Statvfs::is_stale(mountpoint);
+					if (not disk.stale) Statvfs::request(mountpoint, free_priv);
 					++it;
 				}
 
@@ -1948,9 +2934,9 @@ namespace Mem {
 				if (swap_disk and has_swap) {
 					mem.disks_order.push_back("swap");
 					if (not disks.contains("swap")) disks["swap"] = {"", "swap", "swap"};
-					disks.at("swap").total = mem.stats.at("swap_total");
-					disks.at("swap").used = mem.stats.at("swap_used");
-					disks.at("swap").free = mem.stats.at("swap_free");
+					disks.at("swap").total = mem.stats[SWAP_TOTAL];
+					disks.at("swap").used = mem.stats[SWAP_USED];
+					disks.at("swap").free = mem.stats[SWAP_FREE];
 					disks.at("swap").used_percent = mem.percent.at("swap_used").back();
 					disks.at("swap").free_percent = mem.percent.at("swap_free").back();
 				}
@@ -1961,20 +2947,58 @@ namespace Mem {
 						if (not is_in(name, "/", "swap")) mem.disks_order.push_back(name);
 					#endif
 
-				//? Get disks IO
+				//? Get disks IO, block devices from a single read of /proc/diskstats matched by device number
+				static string diskstats_buf;
+				static std::unordered_set<uint64_t> wanted_devs;
+				static std::unordered_map<uint64_t, array<uint64_t, 15>> diskstats;
+				wanted_devs.clear();
+				diskstats.clear();
+				for (const auto& [ignored, disk] : disks)
+					if (disk.devno != 0) wanted_devs.insert(disk.devno);
+
+				//? Lines are "major minor name" followed by up to 17 counters, older kernels have 11
+				if (not wanted_devs.empty() and read_all(Shared::procPath / "diskstats", diskstats_buf)) {
+					const char* p = diskstats_buf.data();
+					const char* const end = p + diskstats_buf.size();
+					auto next_num = [&p, end]() -> uint64_t {
+						while (p < end and *p == ' ') p++;
+						uint64_t val{};
+						for (; p < end and *p >= '0' and *p <= '9'; p++) val = val * 10 + (*p - '0');
+						return val;
+					};
+					while (p < end) {
+						const uint64_t major_num = next_num();
+						const uint64_t minor_num = next_num();
+						const uint64_t devno = makedev(major_num, minor_num);
+						if (wanted_devs.contains(devno)) {
+							while (p < end and *p == ' ') p++;
+							while (p < end and *p != ' ' and *p != '\n') p++;
+							auto& fields = diskstats[devno];
+							fields.fill(0);
+							for (size_t i = 0; i < fields.size() and p < end and *p != '\n'; i++) fields[i] = next_num();
+						}
+						while (p < end and *p != '\n') p++;
+						if (p < end) p++;
+					}
+				}
+
+				const double io_seconds = max(0.001, uptime - old_uptime);
+				auto push_io = [](deque<long long>& values, long long value) {
+					values.push_back(value);
+					while (cmp_greater(values.size(), width * 2)) values.pop_front();
+				};
 				int64_t sectors_read, sectors_write, io_ticks, io_ticks_temp;
 				disk_ios = 0;
 				for (auto& [ignored, disk] : disks) {
-					if (disk.stat.empty() or access(disk.stat.c_str(), R_OK) != 0) continue;
-					if (disk.fstype == "zfs" && zfs_hide_datasets && zfs_collect_pool_total_stats(disk)) {
-						disk_ios++;
-						continue;
-					}
-					diskread.open(disk.stat);
-					if (diskread.good()) {
-						disk_ios++;
-						//? ZFS Pool Support
-						if (disk.fstype == "zfs") {
+					if (disk.fstype == "zfs") {
+						if (disk.stat.empty() or access(disk.stat.c_str(), R_OK) != 0) continue;
+						if (zfs_hide_datasets && zfs_collect_pool_total_stats(disk)) {
+							disk_ios++;
+							continue;
+						}
+						diskread.open(disk.stat);
+						if (diskread.good()) {
+							disk_ios++;
 							// skip first three lines
 							for (int i = 0; i < 3; i++) diskread.ignore(numeric_limits<streamsize>::max(), '\n');
 							// skip characters until '4' is reached, indicating data type 4, next value will be out target
@@ -2012,38 +3036,39 @@ namespace Mem {
 								disk.io_activity.push_back(max((int64_t)0, (io_ticks - disk.old_io.at(2))));
 							disk.old_io.at(2) = io_ticks;
 							while (cmp_greater(disk.io_activity.size(), width * 2)) disk.io_activity.pop_front();
-						} else {
-							for (int i = 0; i < 2; i++) { diskread >> std::ws; diskread.ignore(SSmax, ' '); }
-							diskread >> sectors_read;
-							if (disk.io_read.empty())
-								disk.io_read.push_back(0);
-							else
-								disk.io_read.push_back(max((int64_t)0, (sectors_read - disk.old_io.at(0)) * 512));
-							disk.old_io.at(0) = sectors_read;
-							while (cmp_greater(disk.io_read.size(), width * 2)) disk.io_read.pop_front();
-
-							for (int i = 0; i < 3; i++) { diskread >> std::ws; diskread.ignore(SSmax, ' '); }
-							diskread >> sectors_write;
-							if (disk.io_write.empty())
-								disk.io_write.push_back(0);
-							else
-								disk.io_write.push_back(max((int64_t)0, (sectors_write - disk.old_io.at(1)) * 512));
-							disk.old_io.at(1) = sectors_write;
-							while (cmp_greater(disk.io_write.size(), width * 2)) disk.io_write.pop_front();
-
-							for (int i = 0; i < 2; i++) { diskread >> std::ws; diskread.ignore(SSmax, ' '); }
-							diskread >> io_ticks;
-							if (disk.io_activity.empty())
-								disk.io_activity.push_back(0);
-							else
-								disk.io_activity.push_back(clamp((long)round((double)(io_ticks - disk.old_io.at(2)) / (uptime - old_uptime) / 10), 0l, 100l));
-							disk.old_io.at(2) = io_ticks;
-							while (cmp_greater(disk.io_activity.size(), width * 2)) disk.io_activity.pop_front();
 						}
-					} else {
-						Logger::debug("Error in Mem::collect() : when opening " + string{disk.stat});
+						else {
+							Logger::debug("Error in Mem::collect() : when opening " + string{disk.stat});
+						}
+						diskread.close();
+						continue;
 					}
-					diskread.close();
+
+					const auto stat_it = diskstats.find(disk.devno);
+					if (disk.devno == 0 or stat_it == diskstats.end()) continue;
+					disk_ios++;
+
+					//? Field numbers as in the kernel iostats documentation, minus one
+					const auto& fields = stat_it->second;
+					const bool first_run = disk.io_read.empty();
+					sectors_read = fields[2];
+					sectors_write = fields[6];
+					io_ticks = fields[9];
+					push_io(disk.io_read, (first_run ? 0 : max((int64_t)0, (sectors_read - disk.old_io.at(0)) * 512)));
+					push_io(disk.io_write, (first_run ? 0 : max((int64_t)0, (sectors_write - disk.old_io.at(1)) * 512)));
+					push_io(disk.io_activity, (first_run ? 0 : clamp((long)round((double)(io_ticks - disk.old_io.at(2)) / io_seconds / 10), 0l, 100l)));
+					disk.old_io = {sectors_read, sectors_write, io_ticks};
+
+					//? Reads, writes, ms reading, ms writing, weighted ms in queue and sectors discarded
+					const array<uint64_t, 6> ops = {fields[0], fields[4], fields[3], fields[7], fields[10], fields[13]};
+					array<uint64_t, 6> diff{};
+					for (size_t i = 0; i < ops.size(); i++) diff[i] = (first_run or ops[i] < disk.old_ops[i] ? 0 : ops[i] - disk.old_ops[i]);
+					disk.old_ops = ops;
+					const uint64_t io_count = diff[0] + diff[1];
+					push_io(disk.io_iops, round(io_count / io_seconds));
+					push_io(disk.io_await, (io_count > 0 ? (diff[2] + diff[3]) * 1000 / io_count : 0));
+					push_io(disk.io_queue, round(diff[4] / io_seconds / 10));
+					push_io(disk.io_discard, round(diff[5] * 512 / io_seconds));
 				}
 				old_uptime = uptime;
 			}
@@ -2055,6 +3080,32 @@ namespace Mem {
 		return mem;
 	}
 
+	uint64_t get_devno(const fs::path& dev) {
+		if (struct stat st; ::stat(dev.c_str(), &st) == 0)
+			return (S_ISBLK(st.st_mode) ? st.st_rdev : 0);
+
+		const string name = dev.filename();
+		if (name.empty()) return 0;
+		string buf;
+
+		//? /sys/class/block/<name>/dev holds "major:minor"
+		if (read_all(fs::path("/sys/class/block") / name / "dev", buf)) {
+			const auto nums = ssplit(trim(buf, "\n"), ':');
+			if (nums.size() == 2 and isint(nums[0]) and isint(nums[1]))
+				return makedev(stoul(nums[0]), stoul(nums[1]));
+		}
+
+		//? Lines in /proc/diskstats start with "major minor name"
+		if (read_all(Shared::procPath / "diskstats", buf)) {
+			for (const auto& line : ssplit(buf, '\n')) {
+				const auto fields = ssplit(line, ' ');
+				if (fields.size() >= 3 and fields[2] == name and isint(fields[0]) and isint(fields[1]))
+					return makedev(stoul(fields[0]), stoul(fields[1]));
+			}
+		}
+		return 0;
+	}
+
 	fs::path get_zfs_stat_file(const string& device_name, size_t dataset_name_start, bool zfs_hide_datasets) {
 		fs::path zfs_pool_stat_path;
 		if (zfs_hide_datasets) {
@@ -2193,6 +3244,7 @@ namespace Net {
 	std::unordered_map<string, net_info> current_net;
 	net_info empty_net = {};
 	vector<string> interfaces;
+	std::unordered_set<string> interface_set;
 	string selected_iface;
 	int errors{};
 	std::unordered_map<string, uint64_t> graph_max = { {"download", {}}, {"upload", {}} };
@@ -2200,6 +3252,251 @@ namespace Net {
 	bool rescale{true};
 	uint64_t timestamp{};
 
+	//* Persistent NETLINK_ROUTE sockets, links and byte counters are dumped once per update and addresses
+	//* are kept up to date from RTM_NEWADDR/RTM_DELADDR notifications instead of being resolved every update
+	namespace Netlink {
+		struct Link {
+			string name;
+			bool running{};
+			string ipv4, ipv6;
+			uint64_t rx{}, tx{};
+			array<uint64_t, COUNTER_COUNT> counters{};
+		};
+
+		//? Packet and error counters from either rtnl_link_stats64 or rtnl_link_stats
+		template <typename Stats>
+		void set_stats(Link& link, const Stats& stats) {
+			link.rx = stats.rx_bytes;
+			link.tx = stats.tx_bytes;
+			link.counters[RX_PACKETS] = stats.rx_packets;
+			link.counters[TX_PACKETS] = stats.tx_packets;
+			link.counters[RX_DROPPED] = stats.rx_dropped;
+			link.counters[RX_MISSED] = stats.rx_missed_errors;
+			link.counters[TX_ERRORS] = stats.tx_errors;
+			link.counters[FIFO_ERRORS] = stats.rx_fifo_errors + stats.tx_fifo_errors;
+		}
+
+		int sock{-1};		// Requests and dump replies
+		int events{-1};		// Address change notifications, non blocking
+		bool failed{};
+		uint32_t seq{};
+		vector<char> buf(1 << 16);
+		std::unordered_map<int, vector<pair<int, string>>> addresses;	// Interface index to family and address, in the order reported
+
+		//? Add or remove an address from a RTM_NEWADDR or RTM_DELADDR message
+		void handle_address(const nlmsghdr* nh) {
+			const auto* ifa = static_cast<const ifaddrmsg*>(NLMSG_DATA(nh));
+			if (ifa->ifa_family != AF_INET and ifa->ifa_family != AF_INET6) return;
+			const void* addr = nullptr;
+			int len = IFA_PAYLOAD(nh);
+			for (auto* rta = IFA_RTA(ifa); RTA_OK(rta, len); rta = RTA_NEXT(rta, len)) {
+				//? IFA_LOCAL is the interface's own address on point to point links, like getifaddrs() reports
+				if (rta->rta_type == IFA_LOCAL or (rta->rta_type == IFA_ADDRESS and addr == nullptr))
+					addr = RTA_DATA(rta);
+			}
+			char ip[INET6_ADDRSTRLEN];
+			if (addr == nullptr or inet_ntop(ifa->ifa_family, addr, ip, sizeof(ip)) == nullptr) return;
+
+			auto& list = addresses[ifa->ifa_index];
+			const pair<int, string> entry {ifa->ifa_family, ip};
+			auto it = rng::find(list, entry);
+			if (nh->nlmsg_type == RTM_NEWADDR and it == list.end())
+				list.push_back(entry);
+			else if (nh->nlmsg_type == RTM_DELADDR and it != list.end())
+				list.erase(it);
+		}
+
+		//* Send a dump request of <type> and call <handler> for each reply message, false on failure
+		template <typename F>
+		bool dump(uint16_t type, F&& handler) {
+			struct {
+				nlmsghdr nh;
+				rtgenmsg gen;
+			} req{};
+			req.nh.nlmsg_len = NLMSG_LENGTH(sizeof(rtgenmsg));
+			req.nh.nlmsg_type = type;
+			req.nh.nlmsg_flags = NLM_F_REQUEST | NLM_F_DUMP;
+			req.nh.nlmsg_seq = ++seq;
+			req.gen.rtgen_family = AF_UNSPEC;
+			if (send(sock, &req, req.nh.nlmsg_len, 0) < 0) return false;
+
+			while (true) {
+				const ssize_t len = recv(sock, buf.data(), buf.size(), 0);
+				if (len < 0) {
+					if (errno == EINTR) continue;
+					return false;
+				}
+				int remaining = len;
+				for (auto* nh = reinterpret_cast<nlmsghdr*>(buf.data()); NLMSG_OK(nh, remaining); nh = NLMSG_NEXT(nh, remaining)) {
+					if (nh->nlmsg_seq != seq) continue;
+					if (nh->nlmsg_type == NLMSG_DONE) return true;
+					if (nh->nlmsg_type == NLMSG_ERROR) return false;
+					handler(nh);
+				}
+			}
+		}
+
+		//? Read all queued address notifications, the full list is fetched again if any were dropped
+		bool read_events() {
+			while (true) {
+				const ssize_t len = recv(events, buf.data(), buf.size(), MSG_DONTWAIT);
+				if (len < 0) {
+					if (errno == EINTR) continue;
+					if (errno == EAGAIN or errno == EWOULDBLOCK) return true;
+					if (errno == ENOBUFS) {
+						addresses.clear();
+						return dump(RTM_GETADDR, handle_address);
+					}
+					return false;
+				}
+				int remaining = len;
+				for (auto* nh = reinterpret_cast<nlmsghdr*>(buf.data()); NLMSG_OK(nh, remaining); nh = NLMSG_NEXT(nh, remaining)) {
+					if (nh->nlmsg_type == RTM_NEWADDR or nh->nlmsg_type == RTM_DELADDR) handle_address(nh);
+				}
+			}
+		}
+
+		//? Open the sockets, subscribe to address changes and get the current addresses
+		bool init() {
+			sock = socket(AF_NETLINK, SOCK_RAW | SOCK_CLOEXEC, NETLINK_ROUTE);
+			events = socket(AF_NETLINK, SOCK_RAW | SOCK_CLOEXEC | SOCK_NONBLOCK, NETLINK_ROUTE);
+			if (sock < 0 or events < 0) return false;
+			sockaddr_nl addr{};
+			addr.nl_family = AF_NETLINK;
+			addr.nl_groups = RTMGRP_IPV4_IFADDR | RTMGRP_IPV6_IFADDR;
+			if (bind(events, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) < 0) return false;
+			return dump(RTM_GETADDR, handle_address);
+		}
+
+		//* Get all links with state, addresses and byte counters from one RTM_GETLINK dump, false if netlink can't be used
+		bool collect(vector<Link>& links) {
+			if (failed) return false;
+			if (sock < 0 and not init()) {
+				Logger::warning("Net::collect() -> Failed to open netlink socket, using getifaddrs() and /sys/class/net instead.");
+				failed = true;
+				return false;
+			}
+			if (not read_events()) {
+				Logger::warning("Net::collect() -> Failed to read netlink address notifications, using getifaddrs() and /sys/class/net instead.");
+				failed = true;
+				return false;
+			}
+
+			links.clear();
+			const bool ok = dump(RTM_GETLINK, [&links](const nlmsghdr* nh) {
+				if (nh->nlmsg_type != RTM_NEWLINK) return;
+				const auto* ifi = static_cast<const ifinfomsg*>(NLMSG_DATA(nh));
+				auto& link = links.emplace_back();
+				link.running = (ifi->ifi_flags & IFF_RUNNING);
+				bool got_stats64{};
+				const unsigned char* hw_addr = nullptr;
+				size_t hw_len{};
+				int len = IFLA_PAYLOAD(nh);
+				for (auto* rta = IFLA_RTA(ifi); RTA_OK(rta, len); rta = RTA_NEXT(rta, len)) {
+					if (rta->rta_type == IFLA_IFNAME)
+						link.name = static_cast<const char*>(RTA_DATA(rta));
+					else if (rta->rta_type == IFLA_STATS64 and RTA_PAYLOAD(rta) >= sizeof(rtnl_link_stats64)) {
+						rtnl_link_stats64 stats;
+						std::memcpy(&stats, RTA_DATA(rta), sizeof(stats));
+						set_stats(link, stats);
+						got_stats64 = true;
+					}
+					else if (rta->rta_type == IFLA_STATS and not got_stats64 and RTA_PAYLOAD(rta) >= sizeof(rtnl_link_stats)) {
+						rtnl_link_stats stats;
+						std::memcpy(&stats, RTA_DATA(rta), sizeof(stats));
+						set_stats(link, stats);
+					}
+					else if (rta->rta_type == IFLA_ADDRESS) {
+						hw_addr = static_cast<const unsigned char*>(RTA_DATA(rta));
+						hw_len = RTA_PAYLOAD(rta);
+					}
+				}
+				if (link.name.empty()) {
+					links.pop_back();
+					return;
+				}
+
+				//? First address of each family, or the hardware address if the interface has none
+				if (auto it = addresses.find(ifi->ifi_index); it != addresses.end()) {
+					for (const auto& [family, ip] : it->second) {
+						if (family == AF_INET and link.ipv4.empty()) link.ipv4 = ip;
+						else if (family == AF_INET6 and link.ipv6.empty()) link.ipv6 = ip;
+					}
+				}
+				if (link.ipv4.empty() and link.ipv6.empty()) {
+					for (size_t i = 0; i < hw_len; i++)
+						link.ipv4 += fmt::format("{}{:02x}", (i > 0 ? ":" : ""), hw_addr[i]);
+				}
+			});
+			if (not ok) {
+				Logger::warning("Net::collect() -> Netlink RTM_GETLINK dump failed, using getifaddrs() and /sys/class/net instead.");
+				failed = true;
+			}
+			return ok;
+		}
+	}
+
+	//* Update proto_stats from /proc/net/snmp and /proc/net/netstat, buffers are reused so nothing is allocated after the first call
+	void collect_proto() {
+		static string snmp_buf, netstat_buf;
+		static array<uint64_t, PROTO_COUNT> old_values{};
+		static uint64_t last_time{};
+		//? Files hold pairs of "Prefix: Name Name ..." and "Prefix: value value ..." lines
+		static constexpr array<std::tuple<std::string_view, std::string_view, Proto>, PROTO_COUNT> fields {{
+			{"Tcp:", "CurrEstab", TCP_ESTABLISHED}, {"Tcp:", "ActiveOpens", TCP_ACTIVE_OPENS}, {"Tcp:", "PassiveOpens", TCP_PASSIVE_OPENS},
+			{"Tcp:", "RetransSegs", TCP_RETRANS}, {"TcpExt:", "ListenOverflows", TCP_LISTEN_OVERFLOWS}, {"TcpExt:", "ListenDrops", TCP_LISTEN_DROPS},
+			{"Udp:", "RcvbufErrors", UDP_RCVBUF_ERRORS}
+		}};
+		array<uint64_t, PROTO_COUNT> values{};
+
+		auto parse = [&values](std::string_view buf) {
+			auto next_line = [&buf]() {
+				const size_t eol = buf.find('\n');
+				const std::string_view line = buf.substr(0, eol);
+				buf.remove_prefix(eol == std::string_view::npos ? buf.size() : eol + 1);
+				return line;
+			};
+			while (not buf.empty()) {
+				std::string_view names = next_line();
+				std::string_view nums = next_line();
+				const std::string_view prefix = names.substr(0, names.find(' '));
+				if (not nums.starts_with(prefix)) continue;
+				names.remove_prefix(prefix.size());
+				nums.remove_prefix(prefix.size());
+				//? Walk names and values side by side
+				while (not names.empty() and not nums.empty()) {
+					while (names.starts_with(' ')) names.remove_prefix(1);
+					while (nums.starts_with(' ')) nums.remove_prefix(1);
+					const size_t name_end = min(names.find(' '), names.size());
+					const size_t num_end = min(nums.find(' '), nums.size());
+					const std::string_view name = names.substr(0, name_end);
+					for (const auto& [field_prefix, field_name, index] : fields) {
+						if (field_prefix == prefix and field_name == name) {
+							uint64_t val{};
+							for (const char c : nums.substr(0, num_end)) if (c >= '0' and c <= '9') val = val * 10 + (c - '0');
+							values[index] = val;
+						}
+					}
+					names.remove_prefix(name_end);
+					nums.remove_prefix(num_end);
+				}
+			}
+		};
+		if (read_all(Shared::procPath / "net/snmp", snmp_buf)) parse(snmp_buf);
+		if (read_all(Shared::procPath / "net/netstat", netstat_buf)) parse(netstat_buf);
+
+		const uint64_t now = time_ms();
+		const uint64_t elapsed = now - last_time;
+		for (size_t i = 0; i < PROTO_COUNT; i++) {
+			if (i == TCP_ESTABLISHED)
+				proto_stats[i] = values[i];
+			else
+				proto_stats[i] = (last_time == 0 or elapsed == 0 or values[i] < old_values[i] ? 0 : (values[i] - old_values[i]) * 1000 / elapsed);
+		}
+		old_values = values;
+		last_time = now;
+	}
+
 	auto collect(bool no_update) -> net_info& {
 		if (Runner::stopping) return empty_net;
 		auto& net = current_net;
@@ -2209,78 +3506,152 @@ namespace Net {
 		auto new_timestamp = time_ms();
 
 		if (not no_update and errors < 3) {
-			//? Get interface list using getifaddrs() wrapper
-			IfAddrsPtr if_addrs {};
-			if (if_addrs.get_status() != 0) {
-				errors++;
-				Logger::error("Net::collect() -> getifaddrs() failed with id " + to_string(if_addrs.get_status()));
-				redraw = true;
-				return empty_net;
-			}
-			int family = 0;
-			static_assert(INET6_ADDRSTRLEN >= INET_ADDRSTRLEN); // 46 >= 16, compile-time assurance.
-			enum { IPBUFFER_MAXSIZE = INET6_ADDRSTRLEN }; // manually using the known biggest value, guarded by the above static_assert
-			char ip[IPBUFFER_MAXSIZE];
+			static vector<Netlink::Link> links;
 			interfaces.clear();
-			string ipv4, ipv6;
 
-			//? Iteration over all items in getifaddrs() list
-			for (auto* ifa = if_addrs.get(); ifa != nullptr; ifa = ifa->ifa_next) {
-				if (ifa->ifa_addr == nullptr) continue;
-				family = ifa->ifa_addr->sa_family;
-				const auto& iface = ifa->ifa_name;
-
-				//? Update available interfaces vector and get status of interface
-				if (not v_contains(interfaces, iface)) {
-					interfaces.push_back(iface);
-					net[iface].connected = (ifa->ifa_flags & IFF_RUNNING);
-
-					// An interface can have more than one IP of the same family associated with it,
-					// but we pick only the first one to show in the NET box.
-					// Note: Interfaces without any IPv4 and IPv6 set are still valid and monitorable!
-					net[iface].ipv4.clear();
-					net[iface].ipv6.clear();
+			//? Get interfaces, addresses and byte counters from netlink, or getifaddrs() and /sys/class/net if that fails
+			if (not Netlink::collect(links)) {
+				IfAddrsPtr if_addrs {};
+				if (if_addrs.get_status() != 0) {
+					errors++;
+					Logger::error("Net::collect() -> getifaddrs() failed with id " + to_string(if_addrs.get_status()));
+					redraw = true;
+					return empty_net;
 				}
+				int family = 0;
+				static_assert(INET6_ADDRSTRLEN >= INET_ADDRSTRLEN); // 46 >= 16, compile-time assurance.
+				enum { IPBUFFER_MAXSIZE = INET6_ADDRSTRLEN }; // manually using the known biggest value, guarded by the above static_assert
+				char ip[IPBUFFER_MAXSIZE];
+				links.clear();
+
+				//? Iteration over all items in getifaddrs() list
+				for (auto* ifa = if_addrs.get(); ifa != nullptr; ifa = ifa->ifa_next) {
+					if (ifa->ifa_addr == nullptr) continue;
+					family = ifa->ifa_addr->sa_family;
+					const auto& iface = ifa->ifa_name;
+
+					//? Add interface and get status of interface
+					auto link = rng::find(links, iface, &Netlink::Link::name);
+					if (link == links.end()) {
+						// An interface can have more than one IP of the same family associated with it,
+						// but we pick only the first one to show in the NET box.
+						// Note: Interfaces without any IPv4 and IPv6 set are still valid and monitorable!
+						link = links.insert(links.end(), Netlink::Link{});
+						link->name = iface;
+						link->running = (ifa->ifa_flags & IFF_RUNNING) != 0;
+					}
 
-
-				//? Get IPv4 address
-				if (family == AF_INET) {
-					if (net[iface].ipv4.empty()) {
-						if (nullptr != inet_ntop(family, &(reinterpret_cast<struct sockaddr_in*>(ifa->ifa_addr)->sin_addr), ip, IPBUFFER_MAXSIZE)) {
-							net[iface].ipv4 = ip;
-						} else {
-							int errsv = errno;
-							Logger::error("Net::collect() -> Failed to convert IPv4 to string for iface " + string(iface) + ", errno: " + strerror(errsv));
+					//? Get IPv4 address
+					if (family == AF_INET) {
+						if (link->ipv4.empty()) {
+							if (nullptr != inet_ntop(family, &(reinterpret_cast<struct sockaddr_in*>(ifa->ifa_addr)->sin_addr), ip, IPBUFFER_MAXSIZE)) {
+								link->ipv4 = ip;
+							} else {
+								int errsv = errno;
+								Logger::error("Net::collect() -> Failed to convert IPv4 to string for iface " + string(iface) + ", errno: " + strerror(errsv));
+							}
 						}
 					}
-				}
-				//? Get IPv6 address
-				else if (family == AF_INET6) {
-					if (net[iface].ipv6.empty()) {
-						if (nullptr != inet_ntop(family, &(reinterpret_cast<struct sockaddr_in6*>(ifa->ifa_addr)->sin6_addr), ip, IPBUFFER_MAXSIZE)) {
-							net[iface].ipv6 = ip;
-						} else {
-							int errsv = errno;
-							Logger::error("Net::collect() -> Failed to convert IPv6 to string for iface " + string(iface) + ", errno: " + strerror(errsv));
+					//? Get IPv6 address
+					else if (family == AF_INET6) {
+						if (link->ipv6.empty()) {
+							if (nullptr != inet_ntop(family, &(reinterpret_cast<struct sockaddr_in6*>(ifa->ifa_addr)->sin6_addr), ip, IPBUFFER_MAXSIZE)) {
+								link->ipv6 = ip;
+							} else {
+								int errsv = errno;
+								Logger::error("Net::collect() -> Failed to convert IPv6 to string for iface " + string(iface) + ", errno: " + strerror(errsv));
+							}
 						}
+					} //else, ignoring family==AF_PACKET (see man 3 getifaddrs) which is the first one in the `for` loop.
+				}
+
+				//? Get device address if no ip was found
+				for (auto& link : links) {
+					if (link.ipv4.empty() and link.ipv6.empty())
+						link.ipv4 = readfile("/sys/class/net/" + link.name + "/address");
+				}
+
+				//? Get byte, packet and error counters for all interfaces from one read of /proc/net/dev
+				//? Lines are "name: rx bytes packets errs drop fifo frame compressed multicast tx bytes packets errs drop fifo colls carrier compressed"
+				//? where rx drop already includes missed packets, so these are not reported separately
+				static string netdev_buf;
+				if (read_all(Shared::procPath / "net/dev", netdev_buf)) {
+					std::unordered_map<std::string_view, Netlink::Link*> by_name;
+					for (auto& link : links) by_name[link.name] = &link;
+					for (const auto& line : ssplit(netdev_buf, '\n')) {
+						const auto colon = line.find(':');
+						if (colon == string::npos) continue;
+						auto it = by_name.find(trim(line.substr(0, colon)));
+						if (it == by_name.end()) continue;
+						const auto fields = ssplit(line.substr(colon + 1));
+						if (fields.size() < 16 or not rng::all_of(fields, [](const string& f) { return isint(f); })) continue;
+						auto& link = *it->second;
+						link.rx = stoull(fields[0]);
+						link.tx = stoull(fields[8]);
+						link.counters[RX_PACKETS] = stoull(fields[1]);
+						link.counters[TX_PACKETS] = stoull(fields[9]);
+						link.counters[RX_DROPPED] = stoull(fields[3]);
+						link.counters[TX_ERRORS] = stoull(fields[10]);
+						link.counters[FIFO_ERRORS] = stoull(fields[4]) + stoull(fields[12]);
 					}
-				} //else, ignoring family==AF_PACKET (see man 3 getifaddrs) which is the first one in the `for` loop.
+				}
 			}
 
-			//? Get total received and transmitted bytes + device address if no ip was found
-			for (const auto& iface : interfaces) {
-				if (net.at(iface).ipv4.empty() and net.at(iface).ipv6.empty())
-					net.at(iface).ipv4 = readfile("/sys/class/net/" + iface + "/address");
+			//? Interface groups from net_groups, interfaces matching any pattern of a rule are summed into one named after the rule
+			static string groups_config;
+			static vector<pair<string, vector<string>>> group_rules;
+			static std::unordered_map<string, int> group_of;	// Interface name to index in group_rules, -1 if not grouped
+			struct GroupMember {
+				uint64_t rx{}, tx{}, tick{};
+				array<uint64_t, COUNTER_COUNT> counters{};
+			};
+			struct Group {
+				uint64_t rx{}, tx{};	// Sum of member increases, members leaving or joining don't move it backwards
+				array<uint64_t, COUNTER_COUNT> counters{};
+				std::unordered_map<string, GroupMember> members;
+				size_t count{};
+				bool running{};
+			};
+			static vector<Group> groups;
+			static uint64_t tick{};
+			++tick;
+			if (groups_config != Config::getS("net_groups")) {
+				groups_config = Config::getS("net_groups");
+				group_rules.clear();
+				group_of.clear();
+				for (const auto& rule : ssplit(groups_config)) {
+					const auto eq = rule.find('=');
+					if (eq == string::npos or eq == 0) continue;
+					group_rules.emplace_back(rule.substr(0, eq), ssplit(rule.substr(eq + 1), ','));
+				}
+				groups.assign(group_rules.size(), {});
+			}
+			if (group_of.size() > links.size() * 2 + 64) group_of.clear();
+
+			auto update = [&](const Netlink::Link& link) {
+				const auto& iface = link.name;
+				const bool new_iface = not net.contains(iface);
+				interfaces.push_back(iface);
+				interface_set.insert(iface);
+				net[iface].connected = link.running;
+				net[iface].ipv4 = link.ipv4;
+				net[iface].ipv6 = link.ipv6;
+
+				//? Packet and error rates, counters that went backwards are treated as reset
+				auto& info = net.at(iface);
+				const uint64_t elapsed = max<uint64_t>(1, new_timestamp - timestamp);
+				for (size_t i = 0; i < COUNTER_COUNT; i++) {
+					info.rates[i] = (new_iface or link.counters[i] < info.counters[i] ? 0 : (link.counters[i] - info.counters[i]) * 1000 / elapsed);
+					info.counters[i] = link.counters[i];
+				}
+				info.packets.push_back(info.rates[RX_PACKETS] + info.rates[TX_PACKETS]);
+				while (cmp_greater(info.packets.size(), width * 2)) info.packets.pop_front();
 
 				for (const string dir : {"download", "upload"}) {
-					const fs::path sys_file = "/sys/class/net/" + iface + "/statistics/" + (dir == "download" ? "rx_bytes" : "tx_bytes");
 					auto& saved_stat = net.at(iface).stat.at(dir);
 					auto& bandwidth = net.at(iface).bandwidth.at(dir);
 
-					uint64_t val{};
-					try { val = (uint64_t)stoull(readfile(sys_file, "0")); }
-					catch (const std::invalid_argument&) {}
-					catch (const std::out_of_range&) {}
+					const uint64_t val = (dir == "download" ? link.rx : link.tx);
 
 					//? Update speed, total and top values
 					if (val < saved_stat.last) {
@@ -2315,18 +3686,63 @@ namespace Net {
 
 					}
 				}
+			};
+
+			interface_set.clear();
+			for (auto& group : groups) {
+				group.count = 0;
+				group.running = false;
+			}
+			for (const auto& link : links) {
+				if (not group_rules.empty()) {
+					auto [match, inserted] = group_of.try_emplace(link.name, -1);
+					if (inserted) {
+						for (int i = 0; const auto& [name, patterns] : group_rules) {
+							if (rng::any_of(patterns, [&](const string& pattern) { return fnmatch(pattern.c_str(), link.name.c_str(), 0) == 0; })) {
+								match->second = i;
+								break;
+							}
+							i++;
+						}
+					}
+					if (match->second >= 0) {
+						auto& group = groups[match->second];
+						auto [member, joined] = group.members.try_emplace(link.name, GroupMember{link.rx, link.tx, tick, link.counters});
+						if (not joined) {
+							auto& last = member->second;
+							group.rx += (link.rx >= last.rx ? link.rx - last.rx : 0);
+							group.tx += (link.tx >= last.tx ? link.tx - last.tx : 0);
+							for (size_t c = 0; c < COUNTER_COUNT; c++)
+								group.counters[c] += (link.counters[c] >= last.counters[c] ? link.counters[c] - last.counters[c] : 0);
+							last = {link.rx, link.tx, tick, link.counters};
+						}
+						group.count++;
+						group.running |= link.running;
+						continue;
+					}
+				}
+				update(link);
+			}
+			for (size_t i = 0; i < groups.size(); i++) {
+				auto& group = groups[i];
+				if (group.members.size() > group.count) std::erase_if(group.members, [](const auto& member) { return member.second.tick != tick; });
+				if (group.count == 0) continue;
+				update({group_rules[i].first, group.running, to_string(group.count) + " interfaces", "", group.rx, group.tx, group.counters});
 			}
 
 			//? Clean up net map if needed
 			if (net.size() > interfaces.size()) {
 				for (auto it = net.begin(); it != net.end();) {
-					if (not v_contains(interfaces, it->first))
+					if (not interface_set.contains(it->first))
 						it = net.erase(it);
 					else
 						it++;
 				}
 			}
 
+			Net::update_top_talkers(Config::getI("net_top_talkers"));
+			if (Config::getB("net_proto_stats")) collect_proto();
+
 			timestamp = new_timestamp;
 		}
 
@@ -2335,28 +3751,18 @@ namespace Net {
 			return empty_net;
 
 		//? Find an interface to display if selected isn't set or valid
-		if (selected_iface.empty() or not v_contains(interfaces, selected_iface)) {
+		if (selected_iface.empty() or not interface_set.contains(selected_iface)) {
 			max_count["download"][0] = max_count["download"][1] = max_count["upload"][0] = max_count["upload"][1] = 0;
 			redraw = true;
 			if (net_auto) rescale = true;
-			if (not config_iface.empty() and v_contains(interfaces, config_iface)) selected_iface = config_iface;
+			if (not config_iface.empty() and interface_set.contains(config_iface)) selected_iface = config_iface;
+			else if (interfaces.empty()) return empty_net;
 			else {
-				//? Sort interfaces by total upload + download bytes
-				auto sorted_interfaces = interfaces;
-				rng::sort(sorted_interfaces, [&](const auto& a, const auto& b){
-					return 	cmp_greater(net.at(a).stat["download"].total + net.at(a).stat["upload"].total,
-										net.at(b).stat["download"].total + net.at(b).stat["upload"].total);
+				//? Set to the interface with the most total upload + download bytes
+				selected_iface = *rng::max_element(interfaces, [&](const auto& a, const auto& b){
+					return 	cmp_less(net.at(a).stat["download"].total + net.at(a).stat["upload"].total,
+									 net.at(b).stat["download"].total + net.at(b).stat["upload"].total);
 				});
-				selected_iface.clear();
-				//? Try to set to a connected interface
-				for (const auto& iface : sorted_interfaces) {
-					if (net.at(iface).connected) selected_iface = iface;
-					break;
-				}
-				//? If no interface is connected set to first available
-				if (selected_iface.empty() and not sorted_interfaces.empty()) selected_iface = sorted_interfaces.at(0);
-				else if (sorted_interfaces.empty()) return empty_net;
-
 			}
 		}
 
@@ -2506,6 +3912,72 @@ namespace Proc {
 			catch (const std::out_of_range&) {}
 			d_read.close();
 		}
+
+		//? Open file descriptors against the soft limit from the "Max open files" line of proc/[pid]/limits
+		detailed.fds.clear();
+		if (Config::getB("proc_fds") and detailed.entry.fds >= 0) {
+			detailed.fds = to_string(detailed.entry.fds);
+			static string limits_buf;
+			if (read_all(pid_path / "limits", limits_buf)) {
+				if (const auto pos = limits_buf.find("Max open files"); pos != string::npos) {
+					const auto fields = ssplit(limits_buf.substr(pos + 14, limits_buf.find('\n', pos) - pos - 14));
+					if (not fields.empty()) detailed.fds += '/' + (isint(fields[0]) ? count_humanizer(stoull(fields[0])) : fields[0]);
+				}
+			}
+		}
+	}
+
+	//* Count open file descriptors and sockets, visible processes first and then round-robin over the rest until the budget is spent
+	void _collect_fds(vector<proc_info>& procs) {
+		constexpr uint64_t budget_us = 10000;
+		static size_t cursor{};
+		const uint64_t deadline = time_micros() + budget_us;
+		const uint64_t now = time_ms();
+		char link[8];
+
+		auto count = [&](proc_info& p) {
+			if (p.fd_time == now) return;
+			p.fd_time = now;
+			const int dfd = open((Shared::procPath / to_string(p.pid) / "fd").c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+			if (dfd < 0) {
+				p.fds = p.sockets = -1;
+				return;
+			}
+			DIR* dir = fdopendir(dfd);
+			if (dir == nullptr) {
+				close(dfd);
+				p.fds = p.sockets = -1;
+				return;
+			}
+			int fds{}, sockets{};
+			//? Links to sockets read "socket:[inode]", only the prefix is needed
+			while (const auto* ent = readdir(dir)) {
+				if (ent->d_name[0] == '.') continue;
+				fds++;
+				if (readlinkat(dfd, ent->d_name, link, 7) == 7 and std::memcmp(link, "socket:", 7) == 0) sockets++;
+			}
+			closedir(dir);
+			p.fds = fds;
+			p.sockets = sockets;
+		};
+
+		//? Rows currently shown in the proc box go first, least recently counted first so all of them get a turn
+		//? when the budget runs out, the rest is left for the next update and dimmed as stale until counted
+		static vector<proc_info*> shown;
+		shown.clear();
+		const int start = Config::ints.at("proc_start");
+		for (int n = 0; auto& p : procs) {
+			if (p.filtered) continue;
+			if (n >= start + select_max) break;
+			if (n++ >= start) shown.push_back(&p);
+		}
+		rng::sort(shown, rng::less{}, &proc_info::fd_time);
+		for (auto* p : shown) {
+			if (time_micros() >= deadline) return;
+			count(*p);
+		}
+		for (size_t i = 0; i < procs.size() and time_micros() < deadline; i++)
+			count(procs[cursor++ % procs.size()]);
 	}
 
 	//* Collects and sorts process information from /proc
@@ -2518,6 +3990,7 @@ namespace Proc {
 		auto should_filter_kernel = Config::getB("proc_filter_kernel");
 		auto tree = Config::getB("proc_tree");
 		auto show_detailed = Config::getB("show_detailed");
+		auto proc_numa = Config::getB("proc_numa");
 		const size_t detailed_pid = Config::getI("detailed_pid");
 		bool should_filter = current_filter != filter;
 		if (should_filter) current_filter = filter;
@@ -2731,6 +4204,17 @@ namespace Proc {
 									new_proc.mem = totalMem;
 								else
 									new_proc.mem = stoull(short_str) * Shared::pageSize;
+								if (proc_numa) {
+									next_x = 39;
+									continue;
+								}
+								break;
+							case 39: { //? Cpu last executed on, mapped to its NUMA node
+								const auto& cpu_nodes = Mem::get_cpu_nodes();
+								const size_t cpu = stoull(short_str);
+								new_proc.numa_node = (cpu < cpu_nodes.size() ? cpu_nodes[cpu] : -1);
+								break;
+							}
 						}
 						break;
 					}
@@ -2878,6 +4362,10 @@ namespace Proc {
 
 		numpids = (int)current_procs.size() - filter_found;
 
+		//* Count file descriptors and sockets if shown
+		if (Config::getB("proc_fds") and not no_update and not current_procs.empty())
+			_collect_fds(current_procs);
+
 		return current_procs;
 	}
 }
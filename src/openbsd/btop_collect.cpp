@@ -612,33 +612,33 @@ namespace Mem {
 		memWire = uvmexp.wired;
 		// freeMem = uvmexp.free * Shared::pageSize;
 		cachedMem = bcstats.numbufpages * Shared::pageSize;
-		mem.stats.at("used") = memActive;
-		mem.stats.at("available") = Shared::totalMem - memActive - memWire;
-   		mem.stats.at("cached") = cachedMem;
-  		mem.stats.at("free") = Shared::totalMem - memActive - memWire;
+		mem.stats[USED] = memActive;
+		mem.stats[AVAILABLE] = Shared::totalMem - memActive - memWire;
+   		mem.stats[CACHED] = cachedMem;
+  		mem.stats[FREE] = Shared::totalMem - memActive - memWire;
 
 		if (show_swap) {
 			int total = uvmexp.swpages * Shared::pageSize;
-			mem.stats.at("swap_total") = total;
+			mem.stats[SWAP_TOTAL] = total;
 			int swapped = uvmexp.swpgonly * Shared::pageSize;
-			mem.stats.at("swap_used") = swapped;
-			mem.stats.at("swap_free") = total - swapped;
+			mem.stats[SWAP_USED] = swapped;
+			mem.stats[SWAP_FREE] = total - swapped;
 		}
 
-		if (show_swap and mem.stats.at("swap_total") > 0) {
-			for (const auto &name : swap_names) {
-				mem.percent.at(name).push_back(round((double)mem.stats.at(name) * 100 / mem.stats.at("swap_total")));
-				while (cmp_greater(mem.percent.at(name).size(), width * 2))
-					mem.percent.at(name).pop_front();
+		if (show_swap and mem.stats[SWAP_TOTAL] > 0) {
+			for (const auto &stat : swap_names) {
+				mem.percent.at(stat_names[stat]).push_back(round((double)mem.stats[stat] * 100 / mem.stats[SWAP_TOTAL]));
+				while (cmp_greater(mem.percent.at(stat_names[stat]).size(), width * 2))
+					mem.percent.at(stat_names[stat]).pop_front();
 			}
 			has_swap = true;
 		} else
 			has_swap = false;
 		//? Calculate percentages
-		for (const auto &name : mem_names) {
-			mem.percent.at(name).push_back(round((double)mem.stats.at(name) * 100 / Shared::totalMem));
-			while (cmp_greater(mem.percent.at(name).size(), width * 2))
-				mem.percent.at(name).pop_front();
+		for (const auto &stat : mem_names) {
+			mem.percent.at(stat_names[stat]).push_back(round((double)mem.stats[stat] * 100 / Shared::totalMem));
+			while (cmp_greater(mem.percent.at(stat_names[stat]).size(), width * 2))
+				mem.percent.at(stat_names[stat]).pop_front();
 		}
 
 		if (show_disks) {
@@ -737,9 +737,9 @@ namespace Mem {
 				mem.disks_order.push_back("swap");
 				if (not disks.contains("swap"))
 					disks["swap"] = {"", "swap"};
-				disks.at("swap").total = mem.stats.at("swap_total");
-				disks.at("swap").used = mem.stats.at("swap_used");
-				disks.at("swap").free = mem.stats.at("swap_free");
+				disks.at("swap").total = mem.stats[SWAP_TOTAL];
+				disks.at("swap").used = mem.stats[SWAP_USED];
+				disks.at("swap").free = mem.stats[SWAP_FREE];
 				disks.at("swap").used_percent = mem.percent.at("swap_used").back();
 				disks.at("swap").free_percent = mem.percent.at("swap_free").back();
 			}
@@ -908,6 +908,8 @@ namespace Net {
 				}
 			}
 
+			Net::update_top_talkers(Config::getI("net_top_talkers"));
+
 			timestamp = new_timestamp;
 		}
 		//? Return empty net_info struct if no interfaces was found
@@ -684,10 +684,10 @@ namespace Mem {
 		vm_statistics64 p;
 		mach_msg_type_number_t info_size = HOST_VM_INFO64_COUNT;
 		if (host_statistics64(mach_host_self(), HOST_VM_INFO64, (host_info64_t)&p, &info_size) == 0) {
-			mem.stats.at("free") = p.free_count * Shared::pageSize;
-			mem.stats.at("cached") = p.external_page_count * Shared::pageSize;
-			mem.stats.at("used") = (p.active_count + p.wire_count) * Shared::pageSize;
-			mem.stats.at("available") = Shared::totalMem - mem.stats.at("used");
+			mem.stats[FREE] = p.free_count * Shared::pageSize;
+			mem.stats[CACHED] = p.external_page_count * Shared::pageSize;
+			mem.stats[USED] = (p.active_count + p.wire_count) * Shared::pageSize;
+			mem.stats[AVAILABLE] = Shared::totalMem - mem.stats[USED];
 		}
 
 		int mib[2] = {CTL_VM, VM_SWAPUSAGE};
@@ -695,25 +695,25 @@ namespace Mem {
 		struct xsw_usage swap;
 		size_t len = sizeof(struct xsw_usage);
 		if (sysctl(mib, 2, &swap, &len, nullptr, 0) == 0) {
-			mem.stats.at("swap_total") = swap.xsu_total;
-			mem.stats.at("swap_free") = swap.xsu_avail;
-			mem.stats.at("swap_used") = swap.xsu_used;
+			mem.stats[SWAP_TOTAL] = swap.xsu_total;
+			mem.stats[SWAP_FREE] = swap.xsu_avail;
+			mem.stats[SWAP_USED] = swap.xsu_used;
 		}
 
-		if (show_swap and mem.stats.at("swap_total") > 0) {
-			for (const auto &name : swap_names) {
-				mem.percent.at(name).push_back(round((double)mem.stats.at(name) * 100 / mem.stats.at("swap_total")));
-				while (cmp_greater(mem.percent.at(name).size(), width * 2))
-					mem.percent.at(name).pop_front();
+		if (show_swap and mem.stats[SWAP_TOTAL] > 0) {
+			for (const auto &stat : swap_names) {
+				mem.percent.at(stat_names[stat]).push_back(round((double)mem.stats[stat] * 100 / mem.stats[SWAP_TOTAL]));
+				while (cmp_greater(mem.percent.at(stat_names[stat]).size(), width * 2))
+					mem.percent.at(stat_names[stat]).pop_front();
 			}
 			has_swap = true;
 		} else
 			has_swap = false;
 		//? Calculate percentages
-		for (const auto &name : mem_names) {
-			mem.percent.at(name).push_back(round((double)mem.stats.at(name) * 100 / Shared::totalMem));
-			while (cmp_greater(mem.percent.at(name).size(), width * 2))
-				mem.percent.at(name).pop_front();
+		for (const auto &stat : mem_names) {
+			mem.percent.at(stat_names[stat]).push_back(round((double)mem.stats[stat] * 100 / Shared::totalMem));
+			while (cmp_greater(mem.percent.at(stat_names[stat]).size(), width * 2))
+				mem.percent.at(stat_names[stat]).pop_front();
 		}
 
 		if (show_disks) {
@@ -809,9 +809,9 @@ namespace Mem {
 				mem.disks_order.push_back("swap");
 				if (not disks.contains("swap"))
 					disks["swap"] = {"", "swap"};
-				disks.at("swap").total = mem.stats.at("swap_total");
-				disks.at("swap").used = mem.stats.at("swap_used");
-				disks.at("swap").free = mem.stats.at("swap_free");
+				disks.at("swap").total = mem.stats[SWAP_TOTAL];
+				disks.at("swap").used = mem.stats[SWAP_USED];
+				disks.at("swap").free = mem.stats[SWAP_FREE];
 				disks.at("swap").used_percent = mem.percent.at("swap_used").back();
 				disks.at("swap").free_percent = mem.percent.at("swap_free").back();
 			}
@@ -989,6 +989,8 @@ namespace Net {
 				}
 			}
 
+			Net::update_top_talkers(Config::getI("net_top_talkers"));
+
 			timestamp = new_timestamp;
 		}
 		//? Return empty net_info struct if no interfaces was found